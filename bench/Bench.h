@@ -0,0 +1,58 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+// ============================================================================
+// 基準測試共用工具
+// ============================================================================
+namespace Bench {
+    using Clock = std::chrono::steady_clock;
+
+    // 自 start 起經過的毫秒數
+    inline double ElapsedMs(Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    // 程式啟動以來的堆積配置次數（BenchMain 取代全域 operator new 計數）
+    uint64_t AllocationCount();
+
+    // 讀取 "--name value" 形式的整數參數
+    inline int GetIntArg(int argc, char* argv[], const char* name, int defaultValue) {
+        for (int i = 0; i + 1 < argc; i++) {
+            if (std::strcmp(argv[i], name) == 0) {
+                return std::atoi(argv[i + 1]);
+            }
+        }
+        return defaultValue;
+    }
+
+    // 讀取 "--name value" 形式的字串參數
+    inline const char* GetStringArg(int argc, char* argv[], const char* name, const char* defaultValue) {
+        for (int i = 0; i + 1 < argc; i++) {
+            if (std::strcmp(argv[i], name) == 0) {
+                return argv[i + 1];
+            }
+        }
+        return defaultValue;
+    }
+}
+
+// ============================================================================
+// 各項基準測試進入點
+// ============================================================================
+int RunMonsterPoolBench(int argc, char* argv[]);
+int RunTickBench(int argc, char* argv[]);
+int RunJobsBench(int argc, char* argv[]);
+int RunReplayBench(int argc, char* argv[]);
+int RunSpawnBench(int argc, char* argv[]);
+int RunContentBench(int argc, char* argv[]);
+int RunRenderBench(int argc, char* argv[]);
+int RunSimdBench(int argc, char* argv[]);
+int RunCollisionBench(int argc, char* argv[]);
+int RunLodBench(int argc, char* argv[]);
+int RunCombatBench(int argc, char* argv[]);
+int RunEventsBench(int argc, char* argv[]);
+int RunMinimapBench(int argc, char* argv[]);
+int RunTextBench(int argc, char* argv[]);
@@ -0,0 +1,83 @@
+#include "Bench.h"
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <new>
+
+// ============================================================================
+// 配置計數：取代全域 operator new，用來確認穩定狀態下沒有堆積配置
+// ============================================================================
+static std::atomic<uint64_t> g_allocationCount(0);
+
+void* operator new(std::size_t size) {
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+uint64_t Bench::AllocationCount() {
+    return g_allocationCount.load(std::memory_order_relaxed);
+}
+
+// ============================================================================
+// 基準測試清單
+// ============================================================================
+struct BenchEntry {
+    const char* name;
+    const char* description;
+    int (*run)(int argc, char* argv[]);
+};
+
+static const BenchEntry BENCHMARKS[] = {
+    { "pool", "Monster update: vector<unique_ptr<Monster>> vs. SoA MonsterPool, plus population counters", RunMonsterPoolBench },
+    { "tick", "Fixed-step simulation ticks: ticks/sec and p50/p99 tick latency", RunTickBench },
+    { "jobs", "Parallel monster update scaling across 1..N threads", RunJobsBench },
+    { "replay", "Headless full-speed replay of an input recording with tick-time histogram", RunReplayBench },
+    { "spawn", "Spawn placement: rejection sampling vs. Poisson-disk placer", RunSpawnBench },
+    { "content", "Content startup: parse text definitions vs. map the compiled cache", RunContentBench },
+    { "render", "Software rasterizer: span kernel throughput and headless frame times per SIMD level", RunRenderBench },
+    { "simd", "Batched squared-distance kernels vs. per-point Vector2D::DistanceTo", RunSimdBench },
+    { "collision", "Monster separation: broad/narrow phase timings and pair counts at 50k monsters", RunCollisionBench },
+    { "lod", "Monster update LOD: full-rate vs. distance-tiered, staggered updates", RunLodBench },
+    { "combat", "Area attack hit resolution: spatial query vs. full scan for arc, circle and line shapes", RunCombatBench },
+    { "events", "Event bus: publish/drain cost and ordering with multiple lock-free producers", RunEventsBench },
+    { "minimap", "Minimap: per-dot fills every frame vs. a pixel-plotted layer redrawn at a lower rate", RunMinimapBench },
+    { "text", "Text cache: LRU hit rate by capacity, formatting every frame vs. only on value change", RunTextBench },
+};
+
+static void PrintUsage() {
+    std::printf("usage: HeroWarBench <name> [options...]\n\n");
+    for (const auto& bench : BENCHMARKS) {
+        std::printf("  %-12s %s\n", bench.name, bench.description);
+    }
+}
+
+// ============================================================================
+// 程式進入點
+// ============================================================================
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        PrintUsage();
+        return 1;
+    }
+
+    for (const auto& bench : BENCHMARKS) {
+        if (std::strcmp(argv[1], bench.name) == 0) {
+            return bench.run(argc - 2, argv + 2);
+        }
+    }
+
+    std::printf("unknown benchmark: %s\n\n", argv[1]);
+    PrintUsage();
+    return 1;
+}
@@ -0,0 +1,171 @@
+#include "Bench.h"
+#include "CollisionSystem.h"
+#include "Simulation.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace {
+
+struct CollisionResult {
+    double avgMs;            // 每步碰撞總耗時
+    double p99Ms;
+    double broadMs;          // 各階段平均
+    double narrowMs;
+    double applyMs;
+    double candidates;       // 每步平均
+    double contacts;
+    double resolved;
+    int maxWait;             // 任一隻怪獸連續未被處理的最多步數
+    int restarts;            // 英雄死亡後重新開始的局數
+    int finalContacts;       // 最後一步仍重疊的對數
+    uint64_t checksum;       // 最終位置的雜湊，確認不同執行緒數的結果一致
+    uint64_t allocations;
+};
+
+CollisionResult RunWithBudget(int budget, int threads, int monsterCount, int ticks, uint64_t seed) {
+    const float deltaTime = GameConstants::FIXED_TIMESTEP;
+
+    ManualClock clock;
+    std::unique_ptr<JobSystem> jobs;
+    Simulation simulation(&clock);
+    if (threads > 1) {
+        jobs.reset(new JobSystem(threads - 1));
+        simulation.SetJobSystem(jobs.get());
+    }
+    simulation.SetSeed(seed);
+    simulation.SetMonsterCount(monsterCount);
+    simulation.SetCollisionBudget(budget);
+    simulation.Reset();
+
+    InputSnapshot select;
+    select.SetKey('1', true);
+    simulation.Tick(select, deltaTime);
+
+    // 英雄不動也不攻擊，只量漫遊與追擊造成的重疊；英雄被圍攻致死後碰撞處理就不再執行，
+    // 此時重新開始一局（重新生成怪獸，不計入量測），只統計碰撞處理確實執行的步
+    InputSnapshot idle;
+    std::vector<double> latencies;
+    latencies.reserve(ticks);
+    std::vector<int> lastResolved(simulation.GetMonsters().GetCapacity(), -1);
+    CollisionResult result = CollisionResult();
+    int t = 0;
+    while (t < ticks) {
+        GameState state = simulation.GetState();
+        if (state != GameState::Playing) {
+            InputSnapshot restart;
+            restart.SetKey(state == GameState::WeaponSelect ? '1' : KeyCodes::SPACE, true);
+            simulation.Tick(restart, deltaTime);
+            clock.Advance(deltaTime * 1000.0);
+            // 新的一局：等待步數從這裡重新起算
+            std::fill(lastResolved.begin(), lastResolved.end(), t - 1);
+            if (state != GameState::WeaponSelect) result.restarts++;
+            continue;
+        }
+
+        uint64_t allocationsBefore = Bench::AllocationCount();
+        simulation.Tick(idle, deltaTime);
+        result.allocations += Bench::AllocationCount() - allocationsBefore;
+        clock.Advance(deltaTime * 1000.0);
+
+        const CollisionStats& stats = simulation.GetCollisionStats();
+        latencies.push_back(stats.broadMs + stats.narrowMs + stats.applyMs);
+        result.broadMs += stats.broadMs;
+        result.narrowMs += stats.narrowMs;
+        result.applyMs += stats.applyMs;
+        result.candidates += stats.candidates;
+        result.contacts += stats.contacts;
+        result.resolved += stats.resolved;
+        result.finalContacts = stats.contacts;
+        for (int id : simulation.GetCollisions().GetResolvedIds()) {
+            result.maxWait = std::max(result.maxWait, t - lastResolved[id] - 1);
+            lastResolved[id] = t;
+        }
+        t++;
+    }
+    // 量測結束時仍在等待的怪獸也要算進去
+    const MonsterPool& pool = simulation.GetMonsters();
+    for (int id = 0; id < pool.GetCapacity(); id++) {
+        if (pool.IsAlive(id)) result.maxWait = std::max(result.maxWait, ticks - 1 - lastResolved[id]);
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    for (double ms : latencies) result.avgMs += ms;
+    result.avgMs /= ticks;
+    result.p99Ms = latencies[(size_t)(0.99 * (latencies.size() - 1))];
+    result.broadMs /= ticks;
+    result.narrowMs /= ticks;
+    result.applyMs /= ticks;
+    result.candidates /= ticks;
+    result.contacts /= ticks;
+    result.resolved /= ticks;
+
+    const MonsterPool& monsters = simulation.GetMonsters();
+    result.checksum = 1469598103934665603ULL;
+    for (int id = 0; id < monsters.GetCapacity(); id++) {
+        Vector2D pos = monsters.GetPosition(id);
+        uint32_t bits[2];
+        std::memcpy(bits, &pos, sizeof(bits));
+        result.checksum = (result.checksum ^ bits[0]) * 1099511628211ULL;
+        result.checksum = (result.checksum ^ bits[1]) * 1099511628211ULL;
+    }
+    return result;
+}
+
+}
+
+// ============================================================================
+// 基準測試：怪獸碰撞分離
+// 參數：--monsters M（預設 50000）、--ticks N（預設 300）、--threads T（預設 1）、
+//       --budget B（每步的距離測試次數，預設為 CollisionSystem::DEFAULT_BUDGET）、--seed S（預設 1）
+// 比較不限預算與限定預算的各階段耗時與重疊對數，以及怪獸最多連續幾步沒有被處理（max wait）；
+// T > 1 時另確認多執行緒結果與單執行緒相同
+// ============================================================================
+int RunCollisionBench(int argc, char* argv[]) {
+    const int monsterCount = Bench::GetIntArg(argc, argv, "--monsters", 50000);
+    const int ticks = std::max(1, Bench::GetIntArg(argc, argv, "--ticks", 300));
+    const int threads = std::max(1, Bench::GetIntArg(argc, argv, "--threads", 1));
+    const int budget = Bench::GetIntArg(argc, argv, "--budget", CollisionSystem::DEFAULT_BUDGET);
+    const int seed = Bench::GetIntArg(argc, argv, "--seed", 1);
+
+    std::printf("monsters %d, ticks %d\n\n", monsterCount, ticks);
+    std::printf("%-9s %-7s %8s %8s %8s %8s %8s %11s %9s %9s %9s %9s\n",
+                "budget", "threads", "avg ms", "p99 ms", "broad", "narrow", "apply",
+                "tests/tick", "pairs", "resolved", "max wait", "end pairs");
+
+    const int budgets[] = { 0, budget };
+    for (int b : budgets) {
+        CollisionResult single = RunWithBudget(b, 1, monsterCount, ticks, (uint64_t)seed);
+        char name[16];
+        if (b > 0) {
+            std::snprintf(name, sizeof(name), "%d", b);
+        } else {
+            std::snprintf(name, sizeof(name), "all");
+        }
+
+        auto print = [&](const CollisionResult& r, int t) {
+            std::printf("%-9s %-7d %8.3f %8.3f %8.3f %8.3f %8.3f %11.0f %9.0f %9.0f %9d %9d\n",
+                        name, t, r.avgMs, r.p99Ms, r.broadMs, r.narrowMs, r.applyMs,
+                        r.candidates, r.contacts, r.resolved, r.maxWait, r.finalContacts);
+        };
+        print(single, 1);
+        if (single.allocations != 0) {
+            std::printf("          %llu allocations during ticks\n", (unsigned long long)single.allocations);
+        }
+        if (single.restarts > 0) {
+            std::printf("          %d restarts after the hero died (not timed)\n", single.restarts);
+        }
+
+        if (threads > 1) {
+            CollisionResult parallel = RunWithBudget(b, threads, monsterCount, ticks, (uint64_t)seed);
+            print(parallel, threads);
+            if (parallel.checksum != single.checksum) {
+                std::printf("          checksum mismatch between 1 and %d threads\n", threads);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,139 @@
+#include "Bench.h"
+#include "CombatResolver.h"
+#include "ContentDatabase.h"
+#include "MonsterPool.h"
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+using namespace GameConstants;
+
+namespace {
+
+struct Swing {
+    Vector2D heroCenter;
+    Direction facing;
+};
+
+struct CombatResult {
+    double usPerSwing;
+    double candidates;       // 每次攻擊平均
+    double targets;
+};
+
+// 對照組：掃過全部存活怪獸逐一做形狀測試，再依距離排序
+int ScanAll(const MonsterPool& pool, const HitArea& area, int maxTargets, std::vector<CombatHit>& hits) {
+    hits.clear();
+    const int* ids = pool.GetActiveIds();
+    for (int i = 0; i < pool.GetAliveCount(); i++) {
+        Vector2D pos = pool.GetPosition(ids[i]);
+        if (area.Contains(pos)) {
+            hits.push_back({ ids[i], pos.DistanceSquaredTo(area.origin) });
+        }
+    }
+    std::sort(hits.begin(), hits.end(), [](const CombatHit& a, const CombatHit& b) {
+        return a.distanceSq != b.distanceSq ? a.distanceSq < b.distanceSq : a.id < b.id;
+    });
+    if (maxTargets > 0 && maxTargets < (int)hits.size()) hits.resize(maxTargets);
+    return (int)hits.size();
+}
+
+}
+
+// ============================================================================
+// 基準測試：範圍攻擊的命中判定
+// 參數：--swings N（預設 2000）、--seed S（預設 1）
+// 怪獸均勻散布整張地圖；對內建內容的每把武器，從隨機位置朝隨機方向攻擊（只收集目標，不扣血），
+// 比較網格查詢與掃過全部怪獸的耗時，並確認兩者的命中清單相同
+// 掃描的成本與怪獸數成正比，只量前面一部分攻擊（10000 隻時全部，之後依怪獸數遞減），整體數秒內跑完
+// ============================================================================
+int RunCombatBench(int argc, char* argv[]) {
+    const int swings = std::max(1, Bench::GetIntArg(argc, argv, "--swings", 2000));
+    const int seed = Bench::GetIntArg(argc, argv, "--seed", 1);
+    const int counts[] = { 10000, 50000, 200000 };
+    const ContentDatabase& content = ContentDatabase::GetDefault();
+    const char* shapeNames[] = { "circle", "arc", "line" };
+    const Direction facings[] = { Direction::Up, Direction::Down, Direction::Left, Direction::Right };
+
+    std::printf("%-9s %-7s %7s %-6s %12s %11s %9s %8s %s\n",
+                "monsters", "shape", "targets", "mode", "us/swing", "candidates", "hits", "allocs", "match");
+    for (int count : counts) {
+        Random spawnRng((uint64_t)seed, (uint64_t)RandomStream::Spawn);
+        SpatialGrid grid;
+        MonsterPool pool(&grid);
+        pool.Reserve(count);
+        for (int i = 0; i < count; i++) {
+            Vector2D pos((float)spawnRng.NextInt(MAP_WIDTH - MONSTER_SIZE),
+                         (float)spawnRng.NextInt(MAP_HEIGHT - MONSTER_SIZE));
+            pool.Spawn(pos, spawnRng.Range(1, 9));
+        }
+
+        Random swingRng((uint64_t)seed, (uint64_t)RandomStream::AI);
+        std::vector<Swing> plan(swings);
+        for (Swing& swing : plan) {
+            swing.heroCenter = Vector2D((float)swingRng.NextInt(MAP_WIDTH), (float)swingRng.NextInt(MAP_HEIGHT));
+            swing.facing = facings[swingRng.NextInt(4)];
+        }
+
+        const int scanSwings = std::max(1, std::min(swings, (int)((long long)swings * 10000 / count)));
+        CombatResolver resolver;
+        resolver.Reserve(count);
+        std::vector<CombatHit> scanHits;
+        scanHits.reserve(count);
+
+        for (int w = 0; w < content.GetWeaponCount(); w++) {
+            WeaponStats weapon = content.GetWeapon(w);
+            // 不限命中數時排序的是整個範圍內的目標；限制時只取最近幾隻
+            const int limits[] = { weapon.maxTargets, 0 };
+            const int limitCount = weapon.maxTargets > 0 ? 2 : 1;
+            for (int l = 0; l < limitCount; l++) {
+                const int limit = limits[l];
+
+                CombatResult query = CombatResult();
+                long long allocations = Bench::AllocationCount();
+                auto start = Bench::Clock::now();
+                for (const Swing& swing : plan) {
+                    HitArea area = HitArea::FromWeapon(weapon, swing.heroCenter, swing.facing);
+                    query.targets += resolver.Collect(grid, area, limit);
+                    query.candidates += resolver.GetStats().candidates;
+                }
+                query.usPerSwing = Bench::ElapsedMs(start) * 1000.0 / swings;
+                allocations = Bench::AllocationCount() - allocations;
+
+                CombatResult scan = CombatResult();
+                start = Bench::Clock::now();
+                for (int i = 0; i < scanSwings; i++) {
+                    HitArea area = HitArea::FromWeapon(weapon, plan[i].heroCenter, plan[i].facing);
+                    scan.targets += ScanAll(pool, area, limit, scanHits);
+                }
+                scan.usPerSwing = Bench::ElapsedMs(start) * 1000.0 / scanSwings;
+                scan.candidates = count;
+
+                // 逐次比對命中清單（依相同排序鍵，兩邊順序必須一致）
+                bool match = true;
+                const int checkStep = std::max(1, swings / 50);
+                for (int i = 0; i < swings && match; i += checkStep) {
+                    HitArea area = HitArea::FromWeapon(weapon, plan[i].heroCenter, plan[i].facing);
+                    resolver.Collect(grid, area, limit);
+                    ScanAll(pool, area, limit, scanHits);
+                    const std::vector<CombatHit>& hits = resolver.GetHits();
+                    match = hits.size() == scanHits.size();
+                    for (size_t k = 0; k < hits.size() && match; k++) {
+                        match = hits[k].id == scanHits[k].id;
+                    }
+                }
+
+                char limitText[16];
+                std::snprintf(limitText, sizeof(limitText), limit > 0 ? "%d" : "all", limit);
+                std::printf("%-9d %-7s %7s %-6s %12.3f %11.1f %9.2f %8lld %s\n",
+                            count, shapeNames[(int)weapon.hitShape], limitText, "grid", query.usPerSwing,
+                            query.candidates / swings, query.targets / swings, allocations, match ? "yes" : "NO");
+                std::printf("%-9d %-7s %7s %-6s %12.3f %11.1f %9.2f %8s %s\n",
+                            count, shapeNames[(int)weapon.hitShape], limitText, "scan", scan.usPerSwing,
+                            scan.candidates, scan.targets / scanSwings, "-", "-");
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,132 @@
+#include "Bench.h"
+#include "ContentDatabase.h"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+namespace {
+
+const int REPEATS = 5;
+
+// 產生含 weaponCount 把武器與完整等級表的內容原始檔
+std::string MakeContent(int weaponCount) {
+    std::string text;
+    text.reserve((size_t)weaponCount * 120);
+    char line[160];
+    for (int i = 0; i < weaponCount; i++) {
+        std::snprintf(line, sizeof(line),
+                      "[weapon]\nname = 武器 %d\ndescription = 測試武器 %d\nshape = %s\n"
+                      "damage = %d\ninterval = %d\ncolor = %d, %d, %d\n\n",
+                      i, i, (i % 2) ? "axe" : "sword", 10 + i % 40, 300 + i % 900,
+                      i % 256, (i * 7) % 256, (i * 13) % 256);
+        text += line;
+    }
+    for (int level = 1; level <= GameConstants::MAX_MONSTER_LEVEL; level++) {
+        std::snprintf(line, sizeof(line), "[monster]\nlevel = %d\ncolor = %d, 100, 100\nweight = %d\nspacing = %.1f\n\n",
+                      level, level * 20, 1000 / level, level >= 6 ? 1.5 : 1.0);
+        text += line;
+    }
+    return text;
+}
+
+bool WriteFile(const std::filesystem::path& path, const std::string& text) {
+    FILE* file = std::fopen(path.string().c_str(), "wb");
+    if (!file) return false;
+    size_t written = std::fwrite(text.data(), 1, text.size(), file);
+    return std::fclose(file) == 0 && written == text.size();
+}
+
+// 逐一讀取所有武器，確認兩種來源的內容一致
+int64_t Checksum(const ContentDatabase& content) {
+    int64_t sum = 0;
+    for (int i = 0; i < content.GetWeaponCount(); i++) {
+        WeaponStats weapon = content.GetWeapon(i);
+        sum += weapon.damage * 31 + weapon.attackSpeed + (int64_t)weapon.color + (int64_t)weapon.name.size();
+    }
+    for (int level = 1; level <= GameConstants::MAX_MONSTER_LEVEL; level++) {
+        sum += content.GetSpawnWeight(level) + (int64_t)content.GetMonsterColor(level);
+    }
+    return sum;
+}
+
+}
+
+// ============================================================================
+// 基準測試：內容載入
+// 參數：--weapons N（只測單一大小）
+// 比較解析文字原始檔與映射編譯快取的啟動耗時（各取 REPEATS 次中最快的一次）
+// ============================================================================
+int RunContentBench(int argc, char* argv[]) {
+    const int weaponsOverride = Bench::GetIntArg(argc, argv, "--weapons", 0);
+    const int defaultCounts[] = { 100, 10000, 100000 };
+    const int* counts = weaponsOverride > 0 ? &weaponsOverride : defaultCounts;
+    const int countCount = weaponsOverride > 0 ? 1 : 3;
+
+    std::filesystem::path directory = std::filesystem::temp_directory_path();
+    std::filesystem::path textPath = directory / "herowar_bench_content.txt";
+    std::filesystem::path cachePath = directory / "herowar_bench_content.bin";
+
+    std::printf("%-9s %9s %10s %9s %9s %9s %11s %6s\n",
+                "weapons", "text KB", "parse ms", "save ms", "cache KB", "map ms", "startup ms", "match");
+    for (int i = 0; i < countCount; i++) {
+        int count = counts[i];
+        std::string text = MakeContent(count);
+        if (!WriteFile(textPath, text)) {
+            std::fprintf(stderr, "cannot write %s\n", textPath.string().c_str());
+            return 1;
+        }
+
+        double parseMs = 1e9;
+        double saveMs = 1e9;
+        double mapMs = 1e9;
+        double startupMs = 1e9;
+        int64_t textSum = 0;
+        int64_t cacheSum = 0;
+        size_t cacheBytes = 0;
+        for (int repeat = 0; repeat < REPEATS; repeat++) {
+            // 第一次啟動：解析原始檔並編譯
+            ContentDatabase parsed;
+            auto start = Bench::Clock::now();
+            if (!parsed.LoadText(textPath)) {
+                std::fprintf(stderr, "parse failed: %s\n", parsed.GetError().c_str());
+                return 1;
+            }
+            parseMs = std::min(parseMs, Bench::ElapsedMs(start));
+
+            start = Bench::Clock::now();
+            parsed.SaveCache(cachePath);
+            saveMs = std::min(saveMs, Bench::ElapsedMs(start));
+            textSum = Checksum(parsed);
+            cacheBytes = parsed.GetImageSize();
+
+            // 之後的啟動：直接映射快取
+            ContentDatabase mapped;
+            start = Bench::Clock::now();
+            if (!mapped.MapCache(cachePath)) {
+                std::fprintf(stderr, "map failed: %s\n", mapped.GetError().c_str());
+                return 1;
+            }
+            mapMs = std::min(mapMs, Bench::ElapsedMs(start));
+            cacheSum = Checksum(mapped);
+
+            // 遊戲實際使用的路徑（含快取新舊檢查）
+            ContentDatabase loaded;
+            loaded.Load(textPath, cachePath);
+            if (loaded.GetSource() != ContentDatabase::Source::Cache) {
+                std::fprintf(stderr, "cache was not reused\n");
+                return 1;
+            }
+            startupMs = std::min(startupMs, loaded.GetLoadMs());
+        }
+
+        std::printf("%-9d %9.1f %10.3f %9.3f %9.1f %9.3f %11.3f %6s\n",
+                    count, text.size() / 1024.0, parseMs, saveMs, cacheBytes / 1024.0,
+                    mapMs, startupMs, textSum == cacheSum ? "yes" : "NO");
+    }
+
+    std::error_code error;
+    std::filesystem::remove(textPath, error);
+    std::filesystem::remove(cachePath, error);
+    return 0;
+}
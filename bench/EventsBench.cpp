@@ -0,0 +1,111 @@
+#include "Bench.h"
+#include "EventBus.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct EventsResult {
+    double nsPerEvent;
+    uint64_t received;
+    uint64_t fullRetries;    // 緩衝區已滿、發布端重試的次數
+    bool ordered;            // 每個發布端的事件是否依序抵達
+};
+
+// 發布端以 monsterId 標記自己、damage 標記序號；緩衝區滿時讓出執行緒後重試，確認沒有遺失
+EventsResult RunProducers(int producers, int eventsPerProducer, int batchSize) {
+    EventBus bus;
+    std::vector<GameEvent> batch(batchSize);
+    std::vector<int> nextSequence(producers, 0);
+    std::atomic<uint64_t> retries(0);
+    std::atomic<bool> go(false);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&, p]() {
+            while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+            uint64_t localRetries = 0;
+            for (int i = 0; i < eventsPerProducer; i++) {
+                GameEvent event = GameEvent::MakeDamageDealt(p, i, 0, false, Vector2D());
+                while (!bus.Publish(event)) {
+                    localRetries++;
+                    std::this_thread::yield();
+                }
+            }
+            retries.fetch_add(localRetries);
+        });
+    }
+
+    EventsResult result = EventsResult();
+    result.ordered = true;
+    const uint64_t total = (uint64_t)producers * eventsPerProducer;
+    auto start = Bench::Clock::now();
+    go.store(true, std::memory_order_release);
+    while (result.received < total) {
+        int count = bus.Drain(batch.data(), batchSize);
+        if (count == 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (int i = 0; i < count; i++) {
+            const DamageDealtEvent& event = batch[i].damageDealt;
+            if (event.damage != nextSequence[event.monsterId]) result.ordered = false;
+            nextSequence[event.monsterId] = event.damage + 1;
+        }
+        result.received += count;
+    }
+    result.nsPerEvent = Bench::ElapsedMs(start) * 1e6 / total;
+    for (std::thread& thread : threads) thread.join();
+
+    result.fullRetries = retries.load();
+    // 重試的事件最終都送達，因此捨棄計數等於重試次數
+    if (bus.GetDropped() != result.fullRetries || bus.GetPublished() != total) result.ordered = false;
+    return result;
+}
+
+}
+
+// ============================================================================
+// 基準測試：事件匯流排
+// 參數：--events N（每個發布端，預設 1000000）、--batch B（每次取出上限，預設 256）
+// 先量單執行緒發布一批、取出一批的成本與配置次數，再量多個發布端同時發布、單一讀取端整批取出，
+// 並確認每個發布端的事件都依序抵達、沒有遺失
+// ============================================================================
+int RunEventsBench(int argc, char* argv[]) {
+    const int eventsPerProducer = std::max(1, Bench::GetIntArg(argc, argv, "--events", 1000000));
+    const int batchSize = std::max(1, Bench::GetIntArg(argc, argv, "--batch", 256));
+
+    // 單執行緒：模擬每步發布、每幀取出
+    {
+        EventBus bus;
+        std::vector<GameEvent> batch(bus.GetCapacity());
+        const int perFrame = 1000;
+        const int frames = std::max(1, eventsPerProducer / perFrame);
+        uint64_t received = 0;
+        uint64_t allocations = Bench::AllocationCount();
+        auto start = Bench::Clock::now();
+        for (int f = 0; f < frames; f++) {
+            for (int i = 0; i < perFrame; i++) {
+                bus.Publish(GameEvent::MakeMonsterKilled(i, 1 + i % 9, 50, Vector2D()));
+            }
+            received += bus.Drain(batch.data(), (int)batch.size());
+        }
+        double ms = Bench::ElapsedMs(start);
+        allocations = Bench::AllocationCount() - allocations;
+        std::printf("single thread  %d events/frame  %.2f ns/event  received %llu / %llu  allocations %llu\n",
+                    perFrame, ms * 1e6 / ((double)frames * perFrame), (unsigned long long)received,
+                    (unsigned long long)frames * perFrame, (unsigned long long)allocations);
+    }
+
+    std::printf("\n%-10s %12s %12s %14s %s\n", "producers", "ns/event", "received", "full retries", "ordered");
+    const int producerCounts[] = { 1, 2, 4 };
+    for (int producers : producerCounts) {
+        EventsResult r = RunProducers(producers, eventsPerProducer, batchSize);
+        std::printf("%-10d %12.2f %12llu %14llu %s\n", producers, r.nsPerEvent,
+                    (unsigned long long)r.received, (unsigned long long)r.fullRetries, r.ordered ? "yes" : "NO");
+    }
+    return 0;
+}
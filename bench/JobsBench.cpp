@@ -0,0 +1,79 @@
+#include "Bench.h"
+#include "JobSystem.h"
+#include "MonsterPool.h"
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+using namespace GameConstants;
+
+namespace {
+
+struct JobsResult {
+    double msPerFrame;
+    uint64_t checksum;       // 最終位置的雜湊，用來確認不同執行緒數的結果一致
+};
+
+JobsResult RunWithThreads(int threads, int count, int frames, float deltaTime, uint64_t seed) {
+    Random spawnRng(seed, (uint64_t)RandomStream::Spawn);
+    SpatialGrid grid;
+    MonsterPool pool(&grid);
+    pool.SetSeed(seed);
+    pool.Reserve(count);
+    for (int i = 0; i < count; i++) {
+        Vector2D pos((float)(spawnRng.NextInt(MAP_WIDTH - 100) + 50),
+                     (float)(spawnRng.NextInt(MAP_HEIGHT - 100) + 50));
+        pool.Spawn(pos, spawnRng.Range(1, 9));
+    }
+
+    JobSystem jobs(threads - 1);
+    auto start = Bench::Clock::now();
+    for (int f = 0; f < frames; f++) {
+        pool.Update(deltaTime, &jobs);
+    }
+    JobsResult result;
+    result.msPerFrame = Bench::ElapsedMs(start) / frames;
+
+    result.checksum = 1469598103934665603ULL;
+    const float* xs = pool.GetPositionsX();
+    const float* ys = pool.GetPositionsY();
+    for (int i = 0; i < pool.GetCapacity(); i++) {
+        uint32_t bits[2];
+        std::memcpy(&bits[0], &xs[i], sizeof(float));
+        std::memcpy(&bits[1], &ys[i], sizeof(float));
+        result.checksum = (result.checksum ^ bits[0]) * 1099511628211ULL;
+        result.checksum = (result.checksum ^ bits[1]) * 1099511628211ULL;
+    }
+    return result;
+}
+
+}
+
+// ============================================================================
+// 基準測試：工作竊取排程器的怪獸更新擴展性
+// 參數：--monsters M（預設 100000）、--frames N（預設 200）、--threads T（預設硬體執行緒數）、
+//       --seed S（預設 1）
+// 同時比對各執行緒數的最終位置，確認結果具決定性
+// ============================================================================
+int RunJobsBench(int argc, char* argv[]) {
+    const int count = Bench::GetIntArg(argc, argv, "--monsters", 100000);
+    const int frames = Bench::GetIntArg(argc, argv, "--frames", 200);
+    const int maxThreads = std::max(1, Bench::GetIntArg(argc, argv, "--threads",
+                                                        JobSystem::DefaultWorkerCount() + 1));
+    const int seed = Bench::GetIntArg(argc, argv, "--seed", 1);
+    const float deltaTime = FIXED_TIMESTEP;
+
+    std::printf("%-8s %12s %10s %16s %s\n", "threads", "ms/frame", "speedup", "checksum", "match");
+    JobsResult baseline = {};
+    for (int threads = 1; threads <= maxThreads; threads++) {
+        JobsResult result = RunWithThreads(threads, count, frames, deltaTime, (uint64_t)seed);
+        if (threads == 1) baseline = result;
+        std::printf("%-8d %12.4f %9.2fx %016llx %s\n",
+                    threads, result.msPerFrame, baseline.msPerFrame / result.msPerFrame,
+                    (unsigned long long)result.checksum,
+                    result.checksum == baseline.checksum ? "yes" : "NO");
+    }
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include "Bench.h"
+#include "FlowField.h"
+#include "MonsterPool.h"
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+using namespace GameConstants;
+
+namespace {
+
+struct LodResult {
+    double msPerFrame;
+    double p99Ms;
+    MonsterLodStats average;     // 每步平均
+};
+
+LodResult RunPool(bool lod, Vector2D focus, int count, int frames, uint64_t seed) {
+    Random spawnRng(seed, (uint64_t)RandomStream::Spawn);
+    SpatialGrid grid;
+    FlowField field;
+    MonsterPool pool(&grid);
+    pool.SetSeed(seed);
+    pool.Reserve(count);
+    pool.SetFlowField(&field);
+    pool.SetLodEnabled(lod);
+    pool.SetLodFocus(focus);
+    field.SetTarget(focus);
+    for (int i = 0; i < count; i++) {
+        Vector2D pos((float)spawnRng.NextInt(MAP_WIDTH - MONSTER_SIZE),
+                     (float)spawnRng.NextInt(MAP_HEIGHT - MONSTER_SIZE));
+        pool.Spawn(pos, spawnRng.Range(1, 9));
+    }
+
+    // 先跑滿一輪最長的間隔，讓延後步數進入穩定狀態
+    for (int f = 0; f < MonsterPool::LOD_FAR_INTERVAL; f++) {
+        pool.Update(FIXED_TIMESTEP);
+    }
+
+    std::vector<double> latencies;
+    latencies.reserve(frames);
+    LodResult result = LodResult();
+    for (int f = 0; f < frames; f++) {
+        auto start = Bench::Clock::now();
+        pool.Update(FIXED_TIMESTEP);
+        latencies.push_back(Bench::ElapsedMs(start));
+
+        const MonsterLodStats& stats = pool.GetLodStats();
+        result.average.nearCount += stats.nearCount;
+        result.average.midCount += stats.midCount;
+        result.average.farCount += stats.farCount;
+        result.average.updated += stats.updated;
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    for (double ms : latencies) result.msPerFrame += ms;
+    result.msPerFrame /= frames;
+    result.p99Ms = latencies[(size_t)(0.99 * (latencies.size() - 1))];
+    result.average.nearCount /= frames;
+    result.average.midCount /= frames;
+    result.average.farCount /= frames;
+    result.average.updated /= frames;
+    return result;
+}
+
+}
+
+// ============================================================================
+// 基準測試：怪獸更新的 LOD 排程
+// 參數：--frames N（預設 600）、--seed S（預設 1）
+// 怪獸均勻散布整張地圖並追擊焦點；比較每步全部更新與依距離分級錯開更新，
+// 焦點分別放在地圖中央與角落（英雄靠邊時畫面外的怪獸較多）
+// ============================================================================
+int RunLodBench(int argc, char* argv[]) {
+    const int frames = std::max(1, Bench::GetIntArg(argc, argv, "--frames", 600));
+    const int seed = Bench::GetIntArg(argc, argv, "--seed", 1);
+    const int counts[] = { 10000, 50000, 200000 };
+    const struct {
+        const char* name;
+        Vector2D focus;
+    } focuses[] = {
+        { "center", Vector2D(MAP_WIDTH * 0.5f, MAP_HEIGHT * 0.5f) },
+        { "corner", Vector2D(WINDOW_WIDTH * 0.5f, WINDOW_HEIGHT * 0.5f) },
+    };
+
+    std::printf("%-9s %-7s %-4s %10s %9s %8s %8s %8s %9s\n",
+                "monsters", "focus", "lod", "ms/frame", "p99 ms", "near", "mid", "far", "updated");
+    for (int count : counts) {
+        for (const auto& focus : focuses) {
+            for (int lod = 0; lod <= 1; lod++) {
+                LodResult r = RunPool(lod != 0, focus.focus, count, frames, (uint64_t)seed);
+                std::printf("%-9d %-7s %-4s %10.3f %9.3f %8d %8d %8d %9d\n",
+                            count, focus.name, lod ? "on" : "off", r.msPerFrame, r.p99Ms,
+                            r.average.nearCount, r.average.midCount, r.average.farCount, r.average.updated);
+            }
+        }
+    }
+    return 0;
+}
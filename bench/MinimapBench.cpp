@@ -0,0 +1,101 @@
+#include "Bench.h"
+#include "MinimapLayer.h"
+#include "MonsterPool.h"
+#include "Rasterizer.h"
+#include <algorithm>
+#include <cstdio>
+
+using namespace GameConstants;
+
+namespace {
+
+const int MINIMAP_WIDTH = 150;
+const int MINIMAP_HEIGHT = 112;
+
+struct MinimapResult {
+    double msPerFrame;       // 只計小地圖繪製，不含怪獸更新
+    int redraws;
+};
+
+// 對照組：每幀清空後以一次填色呼叫畫一個點（與改版前每個點一次 FillRect 相同）
+MinimapResult RunPerDot(MonsterPool& pool, int frames) {
+    Rasterizer surface;
+    surface.Allocate(MINIMAP_WIDTH, MINIMAP_HEIGHT);
+    const float scaleX = (float)MINIMAP_WIDTH / MAP_WIDTH;
+    const float scaleY = (float)MINIMAP_HEIGHT / MAP_HEIGHT;
+    const uint32_t background = Rasterizer::ToPixel(MakeColor(50, 80, 50));
+    const uint32_t dot = Rasterizer::ToPixel(MakeColor(255, 0, 0));
+
+    MinimapResult result = { 0, 0 };
+    for (int f = 0; f < frames; f++) {
+        pool.Update(FIXED_TIMESTEP);
+        auto start = Bench::Clock::now();
+        surface.Clear(background);
+        const int* ids = pool.GetActiveIds();
+        for (int i = 0; i < pool.GetAliveCount(); i++) {
+            Vector2D pos = pool.GetPosition(ids[i]);
+            int x = (int)(pos.x * scaleX);
+            int y = (int)(pos.y * scaleY);
+            surface.FillRect(x - 2, y - 2, x + 2, y + 2, dot);
+        }
+        result.msPerFrame += Bench::ElapsedMs(start);
+        result.redraws++;
+    }
+    result.msPerFrame /= frames;
+    return result;
+}
+
+MinimapResult RunLayer(MonsterPool& pool, int frames, int interval) {
+    MinimapLayer layer;
+    layer.Allocate(MINIMAP_WIDTH, MINIMAP_HEIGHT);
+    layer.SetInterval(interval);
+
+    MinimapResult result = { 0, 0 };
+    for (int f = 0; f < frames; f++) {
+        pool.Update(FIXED_TIMESTEP);
+        auto start = Bench::Clock::now();
+        layer.Update(pool);
+        result.msPerFrame += Bench::ElapsedMs(start);
+    }
+    result.msPerFrame /= frames;
+    result.redraws = layer.GetRedrawCount();
+    return result;
+}
+
+}
+
+// ============================================================================
+// 基準測試：小地圖
+// 參數：--frames N（預設 600）、--seed S（預設 1）
+// 比較每幀逐點填色、每幀直接寫入像素，以及降頻重畫的圖層；怪獸每幀移動但不生成也不死亡
+// ============================================================================
+int RunMinimapBench(int argc, char* argv[]) {
+    const int frames = std::max(1, Bench::GetIntArg(argc, argv, "--frames", 600));
+    const int seed = Bench::GetIntArg(argc, argv, "--seed", 1);
+    const int counts[] = { 1000, 10000, 100000 };
+
+    std::printf("%-9s %-16s %10s %9s\n", "monsters", "mode", "ms/frame", "redraws");
+    for (int count : counts) {
+        Random spawnRng((uint64_t)seed, (uint64_t)RandomStream::Spawn);
+        MonsterPool pool;
+        pool.SetSeed((uint64_t)seed);
+        pool.Reserve(count);
+        for (int i = 0; i < count; i++) {
+            Vector2D pos((float)spawnRng.NextInt(MAP_WIDTH - MONSTER_SIZE),
+                         (float)spawnRng.NextInt(MAP_HEIGHT - MONSTER_SIZE));
+            pool.Spawn(pos, spawnRng.Range(1, 9));
+        }
+
+        MinimapResult perDot = RunPerDot(pool, frames);
+        std::printf("%-9d %-16s %10.4f %9d\n", count, "per-dot fill", perDot.msPerFrame, perDot.redraws);
+
+        const int intervals[] = { 1, MinimapLayer::DEFAULT_INTERVAL };
+        for (int interval : intervals) {
+            MinimapResult layer = RunLayer(pool, frames, interval);
+            char mode[32];
+            std::snprintf(mode, sizeof(mode), "layer every %d", interval);
+            std::printf("%-9d %-16s %10.4f %9d\n", count, mode, layer.msPerFrame, layer.redraws);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,227 @@
+#include "Bench.h"
+#include "ContentDatabase.h"
+#include "MonsterPool.h"
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+using namespace GameConstants;
+
+// ============================================================================
+// 舊版怪獸配置的複製品：每隻怪獸獨立配置於堆積，經由虛擬函式更新
+// 欄位與行為與改版前的 Character / Monster 相同，作為比較基準
+// ============================================================================
+namespace {
+
+class LegacyCharacter {
+protected:
+    Vector2D position_;
+    int level_;
+    int maxHp_;
+    int currentHp_;
+    int attack_;
+    float speed_;
+    int size_;
+    bool isAlive_;
+    Direction facing_;
+
+public:
+    LegacyCharacter(Vector2D pos, int level, float speed, int size)
+        : position_(pos), level_(level), speed_(speed), size_(size)
+        , isAlive_(true), facing_(Direction::Right)
+    {
+        maxHp_ = BASE_HP + (level - 1) * HP_PER_LEVEL;
+        currentHp_ = maxHp_;
+        attack_ = BASE_ATTACK + (level - 1) * ATTACK_PER_LEVEL;
+    }
+    virtual ~LegacyCharacter() = default;
+
+    bool IsAlive() const { return isAlive_; }
+
+    virtual void Move(Direction dir) {
+        if (!isAlive_) return;
+        facing_ = dir;
+        Vector2D newPos = position_;
+        switch (dir) {
+            case Direction::Up:    newPos.y -= speed_; break;
+            case Direction::Down:  newPos.y += speed_; break;
+            case Direction::Left:  newPos.x -= speed_; break;
+            case Direction::Right: newPos.x += speed_; break;
+            default: break;
+        }
+        newPos.x = std::max(0.0f, std::min(newPos.x, (float)(MAP_WIDTH - size_)));
+        newPos.y = std::max(0.0f, std::min(newPos.y, (float)(MAP_HEIGHT - size_)));
+        position_ = newPos;
+    }
+
+    virtual void Update(float deltaTime) {}
+};
+
+class LegacyMonster : public LegacyCharacter {
+private:
+    Color bodyColor_;
+    int experienceReward_;
+    float wanderTimer_;
+    Direction wanderDirection_;
+
+public:
+    LegacyMonster(Vector2D pos, int level)
+        : LegacyCharacter(pos, level, MONSTER_SPEED + level * 0.2f, MONSTER_SIZE)
+        , wanderTimer_(0), wanderDirection_(Direction::None)
+    {
+        bodyColor_ = ContentDatabase::GetDefault().GetMonsterColor(level);
+        experienceReward_ = level * 50;
+    }
+
+    void Update(float deltaTime) override {
+        LegacyCharacter::Update(deltaTime);
+        if (!isAlive_) return;
+
+        wanderTimer_ += deltaTime;
+        if (wanderTimer_ >= 2.0f + (rand() % 20) / 10.0f) {
+            wanderTimer_ = 0;
+            wanderDirection_ = static_cast<Direction>(rand() % 5);
+        }
+        if (wanderDirection_ != Direction::None) {
+            Move(wanderDirection_);
+        }
+    }
+};
+
+Vector2D RandomPosition() {
+    return Vector2D((float)(rand() % (MAP_WIDTH - 100) + 50),
+                    (float)(rand() % (MAP_HEIGHT - 100) + 50));
+}
+
+// 每幀平均毫秒數
+double RunLegacy(int count, int frames, float deltaTime) {
+    srand(1234);
+    std::vector<std::unique_ptr<LegacyMonster>> monsters;
+    for (int i = 0; i < count; i++) {
+        monsters.push_back(std::make_unique<LegacyMonster>(RandomPosition(), 1 + rand() % 9));
+    }
+
+    auto start = Bench::Clock::now();
+    for (int f = 0; f < frames; f++) {
+        for (auto& monster : monsters) {
+            if (monster->IsAlive()) {
+                monster->Update(deltaTime);
+            }
+        }
+    }
+    return Bench::ElapsedMs(start) / frames;
+}
+
+double RunPool(int count, int frames, float deltaTime, bool withGrid) {
+    srand(1234);
+    SpatialGrid grid;
+    MonsterPool pool(withGrid ? &grid : nullptr);
+    pool.Reserve(count);
+    for (int i = 0; i < count; i++) {
+        Vector2D pos = RandomPosition();
+        pool.Spawn(pos, 1 + rand() % 9);
+    }
+
+    auto start = Bench::Clock::now();
+    for (int f = 0; f < frames; f++) {
+        pool.Update(deltaTime);
+    }
+    return Bench::ElapsedMs(start) / frames;
+}
+
+// 對照組：掃過全部存活怪獸重新統計族群
+MonsterPopulation ScanPopulation(const MonsterPool& pool) {
+    MonsterPopulation population = MonsterPopulation();
+    const int* ids = pool.GetActiveIds();
+    for (int i = 0; i < pool.GetAliveCount(); i++) {
+        int level = pool.GetLevel(ids[i]);
+        population.alive++;
+        population.levelCounts[level]++;
+        population.remainingExperience += MonsterPool::ExperienceForLevel(level);
+    }
+    return population;
+}
+
+bool SamePopulation(const MonsterPopulation& a, const MonsterPopulation& b) {
+    if (a.alive != b.alive || a.remainingExperience != b.remainingExperience) return false;
+    for (int level = 1; level <= MAX_MONSTER_LEVEL; level++) {
+        if (a.levelCounts[level] != b.levelCounts[level]) return false;
+    }
+    return true;
+}
+
+struct PopulationResult {
+    double scanUs;           // 每幀掃描統計的耗時
+    double counterUs;        // 每幀讀取增量統計的耗時
+    bool match;
+};
+
+// 每幀擊殺約 1% 的怪獸再補回同樣數量，比較兩種統計方式
+PopulationResult RunPopulation(int count, int frames) {
+    srand(1234);
+    MonsterPool pool;
+    pool.Reserve(count);
+    for (int i = 0; i < count; i++) {
+        pool.Spawn(RandomPosition(), 1 + rand() % 9);
+    }
+
+    PopulationResult result = { 0, 0, true };
+    volatile int sink = 0;
+    const int churn = std::max(1, count / 100);
+    for (int f = 0; f < frames; f++) {
+        for (int k = 0; k < churn && pool.GetAliveCount() > 0; k++) {
+            int id = pool.GetActiveIds()[rand() % pool.GetAliveCount()];
+            pool.TakeDamage(id, pool.GetCurrentHp(id));
+        }
+        for (int k = 0; k < churn; k++) {
+            pool.Spawn(RandomPosition(), 1 + rand() % 9);
+        }
+
+        auto start = Bench::Clock::now();
+        MonsterPopulation scanned = ScanPopulation(pool);
+        result.scanUs += Bench::ElapsedMs(start) * 1000.0;
+
+        start = Bench::Clock::now();
+        const MonsterPopulation& counted = pool.GetPopulation();
+        sink = sink + counted.alive + counted.remainingExperience;
+        result.counterUs += Bench::ElapsedMs(start) * 1000.0;
+
+        result.match = result.match && SamePopulation(scanned, counted);
+    }
+    result.scanUs /= frames;
+    result.counterUs /= frames;
+    return result;
+}
+
+}
+
+// ============================================================================
+// 基準測試：1k / 10k / 100k 怪獸的每幀更新成本
+// 參數：--frames N（預設 200）
+// 另外比較 HUD 與勝利判定所需的族群統計：每幀掃描存活怪獸 vs 怪獸池增量維護的計數
+// ============================================================================
+int RunMonsterPoolBench(int argc, char* argv[]) {
+    const int frames = Bench::GetIntArg(argc, argv, "--frames", 200);
+    const float deltaTime = 1.0f / 60.0f;
+    const int counts[] = { 1000, 10000, 100000 };
+
+    std::printf("%-10s %14s %14s %16s %10s\n",
+                "monsters", "legacy ms", "pool ms", "pool+grid ms", "speedup");
+    for (int count : counts) {
+        double legacy = RunLegacy(count, frames, deltaTime);
+        double pool = RunPool(count, frames, deltaTime, false);
+        double pooledGrid = RunPool(count, frames, deltaTime, true);
+        std::printf("%-10d %14.4f %14.4f %16.4f %9.2fx\n",
+                    count, legacy, pool, pooledGrid, legacy / pool);
+    }
+
+    // 族群統計：每幀掃描 vs 生成與死亡時增量維護
+    std::printf("\n%-10s %14s %14s %8s\n", "monsters", "scan us", "counters us", "match");
+    for (int count : counts) {
+        PopulationResult r = RunPopulation(count, frames);
+        std::printf("%-10d %14.3f %14.3f %8s\n", count, r.scanUs, r.counterUs, r.match ? "yes" : "NO");
+    }
+    return 0;
+}
@@ -0,0 +1,161 @@
+#include "Bench.h"
+#include "Rasterizer.h"
+#include "SoftwareRenderer.h"
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+using namespace GameConstants;
+
+namespace {
+
+// 像素內容的雜湊，用來確認各 SIMD 等級畫出完全相同的畫面
+uint64_t HashPixels(const Rasterizer& surface) {
+    uint64_t hash = 1469598103934665603ull;
+    for (int y = 0; y < surface.GetHeight(); y++) {
+        const uint32_t* row = surface.GetRow(y);
+        for (int x = 0; x < surface.GetWidth(); x++) {
+            hash = (hash ^ row[x]) * 1099511628211ull;
+        }
+    }
+    return hash;
+}
+
+// 輸出成 PPM（P6），方便在無視窗環境檢查畫面
+bool WritePpm(const char* path, const Rasterizer& surface) {
+    FILE* file = std::fopen(path, "wb");
+    if (!file) return false;
+
+    std::fprintf(file, "P6\n%d %d\n255\n", surface.GetWidth(), surface.GetHeight());
+    std::vector<uint8_t> line((size_t)surface.GetWidth() * 3);
+    for (int y = 0; y < surface.GetHeight(); y++) {
+        const uint32_t* row = surface.GetRow(y);
+        for (int x = 0; x < surface.GetWidth(); x++) {
+            line[x * 3 + 0] = (uint8_t)(row[x] >> 16);
+            line[x * 3 + 1] = (uint8_t)(row[x] >> 8);
+            line[x * 3 + 2] = (uint8_t)row[x];
+        }
+        std::fwrite(line.data(), 1, line.size(), file);
+    }
+    return std::fclose(file) == 0;
+}
+
+// 單一核心的吞吐量（百萬像素 / 秒）
+double MeasureFill(Rasterizer& surface, int repeats) {
+    auto start = Bench::Clock::now();
+    for (int i = 0; i < repeats; i++) {
+        surface.Clear((uint32_t)i);
+    }
+    double ms = Bench::ElapsedMs(start);
+    return (double)surface.GetWidth() * surface.GetHeight() * repeats / (ms * 1000.0);
+}
+
+double MeasureKeyedBlit(Rasterizer& surface, const Rasterizer& sprite, int repeats) {
+    auto start = Bench::Clock::now();
+    for (int i = 0; i < repeats; i++) {
+        for (int y = 0; y + sprite.GetHeight() <= surface.GetHeight(); y += sprite.GetHeight()) {
+            for (int x = 0; x + sprite.GetWidth() <= surface.GetWidth(); x += sprite.GetWidth()) {
+                surface.BlitKeyed(sprite, 0, 0, sprite.GetWidth(), sprite.GetHeight(), x, y,
+                                  SoftwareRenderer::KEY_PIXEL);
+            }
+        }
+    }
+    double ms = Bench::ElapsedMs(start);
+    int tiles = (surface.GetWidth() / sprite.GetWidth()) * (surface.GetHeight() / sprite.GetHeight());
+    return (double)tiles * sprite.GetWidth() * sprite.GetHeight() * repeats / (ms * 1000.0);
+}
+
+}
+
+// ============================================================================
+// 基準測試：軟體繪圖後端
+// 參數：--monsters M（預設 10000）、--frames N（預設 300）、--seed S（預設 1）、
+//       --out FILE（把最後一幀存成 PPM）
+// 先量測填色與透明貼圖核心，再以各 SIMD 等級繪製整個世界畫面；
+// 畫面雜湊必須一致，代表各版本的輸出逐像素相同
+// ============================================================================
+int RunRenderBench(int argc, char* argv[]) {
+    const int monsterCount = Bench::GetIntArg(argc, argv, "--monsters", 10000);
+    const int frames = Bench::GetIntArg(argc, argv, "--frames", 300);
+    const int seed = Bench::GetIntArg(argc, argv, "--seed", 1);
+    const char* outPath = Bench::GetStringArg(argc, argv, "--out", nullptr);
+    const SimdLevel host = GetHostSimdLevel();
+
+    // 讓怪獸散開、英雄拿起武器後再開始繪製
+    ManualClock clock;
+    Simulation simulation(&clock);
+    simulation.SetSeed((uint64_t)seed);
+    simulation.SetMonsterCount(monsterCount);
+    simulation.Reset();
+    InputSnapshot select;
+    select.SetKey('1', true);
+    simulation.Tick(select, FIXED_TIMESTEP);
+    for (int t = 0; t < 60; t++) {
+        simulation.Tick(InputSnapshot(), FIXED_TIMESTEP);
+        clock.Advance(FIXED_TIMESTEP * 1000.0);
+    }
+
+    SoftwareRenderer renderer;
+    renderer.BuildSprites();
+
+    Rasterizer frame;
+    frame.Allocate(WINDOW_WIDTH, WINDOW_HEIGHT);
+    Rasterizer sprite;
+    sprite.Allocate(SoftwareRenderer::CELL_SIZE, SoftwareRenderer::CELL_SIZE);
+
+    std::printf("host SIMD    %s\n", GetSimdLevelName(host));
+    std::printf("frame        %dx%d, %d monsters, %d frames, sprites built in %.2f ms\n\n",
+                WINDOW_WIDTH, WINDOW_HEIGHT, monsterCount, frames, renderer.GetSpriteBuildMs());
+    std::printf("%-8s %11s %11s %10s %10s %10s %8s %18s\n",
+                "kernel", "fill MP/s", "blit MP/s", "bg ms", "frame ms", "p99 ms", "drawn", "hash");
+
+    for (int level = 0; level <= (int)host; level++) {
+        frame.SetSimdLevel((SimdLevel)level);
+        sprite.SetSimdLevel((SimdLevel)level);
+
+        // 一半透明的測試精靈（棋盤格），近似實際角色格子的透明比例
+        sprite.Clear(SoftwareRenderer::KEY_PIXEL);
+        for (int y = 0; y < sprite.GetHeight(); y += 8) {
+            for (int x = (y / 8 % 2) * 8; x < sprite.GetWidth(); x += 16) {
+                sprite.FillRect(x, y, x + 8, y + 8, 0x00336699);
+            }
+        }
+        double fillRate = MeasureFill(frame, 200);
+        double blitRate = MeasureKeyedBlit(frame, sprite, 200);
+
+        // 鏡頭沿固定路線移動，每幀畫完整的世界畫面
+        std::vector<double> frameMs;
+        frameMs.reserve(frames);
+        double backgroundMs = 0;
+        for (int f = 0; f < frames; f++) {
+            Vector2D camera((float)((f * 3) % (MAP_WIDTH - WINDOW_WIDTH)),
+                            (float)((f * 2) % (MAP_HEIGHT - WINDOW_HEIGHT)));
+            auto start = Bench::Clock::now();
+            renderer.DrawBackground(frame, camera);
+            backgroundMs += Bench::ElapsedMs(start);
+            renderer.DrawMonsters(frame, simulation, camera, 1.0f);
+            renderer.DrawHero(frame, simulation.GetHero(), camera, 1.0f);
+            frameMs.push_back(Bench::ElapsedMs(start));
+        }
+        double totalMs = 0;
+        for (double ms : frameMs) totalMs += ms;
+        std::sort(frameMs.begin(), frameMs.end());
+        double p99 = frameMs.empty() ? 0.0 : frameMs[(size_t)(0.99 * (frameMs.size() - 1))];
+
+        // 固定鏡頭再畫一次，比較各等級的輸出
+        renderer.RenderScene(frame, simulation, Vector2D(400, 300), 1.0f);
+        std::printf("%-8s %11.0f %11.0f %10.3f %10.3f %10.3f %8d %18llx\n",
+                    GetSimdLevelName((SimdLevel)level), fillRate, blitRate,
+                    backgroundMs / std::max(1, frames), totalMs / std::max(1, frames), p99,
+                    (int)renderer.GetVisibleMonsters().size(), (unsigned long long)HashPixels(frame));
+    }
+
+    if (outPath) {
+        if (!WritePpm(outPath, frame)) {
+            std::printf("failed to write %s\n", outPath);
+            return 1;
+        }
+        std::printf("\nwrote %s\n", outPath);
+    }
+    return 0;
+}
@@ -0,0 +1,131 @@
+#include "Bench.h"
+#include "ContentDatabase.h"
+#include "InputRecording.h"
+#include "JobSystem.h"
+#include "Simulation.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+// 對數刻度的直方圖：第 i 格涵蓋 [2^i, 2^(i+1)) 微秒，第 0 格含 0
+const int HISTOGRAM_BUCKETS = 24;
+
+int BucketFor(double microseconds) {
+    int bucket = microseconds < 1.0 ? 0 : (int)std::log2(microseconds);
+    return std::min(bucket, HISTOGRAM_BUCKETS - 1);
+}
+
+}
+
+// ============================================================================
+// 基準測試：錄製檔重播
+// 參數：--file FILE（必填）、--threads T（預設硬體執行緒數）、--histogram CSV（輸出直方圖）、
+//       --content FILE（錄製時使用的內容檔，預設為內建內容）
+// 以與遊戲相同的 Simulation::Tick 路徑全速重播，不經過視窗與計時器，每步都像遊戲一樣取出事件；
+// 內容雜湊與錄製檔不符時拒絕重播；結尾的狀態摘要可用來確認不同版本的重播結果一致
+// ============================================================================
+int RunReplayBench(int argc, char* argv[]) {
+    const char* path = Bench::GetStringArg(argc, argv, "--file", nullptr);
+    const char* histogramPath = Bench::GetStringArg(argc, argv, "--histogram", nullptr);
+    const char* contentPath = Bench::GetStringArg(argc, argv, "--content", nullptr);
+    const int threads = std::max(1, Bench::GetIntArg(argc, argv, "--threads",
+                                                     JobSystem::DefaultWorkerCount() + 1));
+    if (!path) {
+        std::printf("usage: HeroWarBench replay --file FILE [--threads T] [--histogram CSV] [--content FILE]\n");
+        return 1;
+    }
+
+    InputRecording recording;
+    if (!recording.Load(path)) {
+        std::printf("failed to load %s\n", path);
+        return 1;
+    }
+
+    ContentDatabase content;
+    if (contentPath && !content.LoadText(contentPath)) {
+        std::printf("failed to load %s: %s\n", contentPath, content.GetError().c_str());
+        return 1;
+    }
+    if (content.GetContentHash() != recording.GetContentHash()) {
+        std::printf("content mismatch: recording %016llx, %s %016llx (pass the recorded --content file)\n",
+                    (unsigned long long)recording.GetContentHash(), contentPath ? contentPath : "built-in",
+                    (unsigned long long)content.GetContentHash());
+        return 1;
+    }
+
+    const float deltaTime = GameConstants::FIXED_TIMESTEP;
+    ManualClock clock;
+    JobSystem jobs(threads - 1);
+    Simulation simulation(&clock);
+    simulation.SetJobSystem(&jobs);
+    simulation.SetContent(&content);
+    simulation.SetSeed(recording.GetSeed());
+    simulation.SetMonsterCount(recording.GetMonsterCount());
+    simulation.Reset();
+
+    std::vector<double> latencies;
+    latencies.reserve(recording.GetTickCount());
+    int histogram[HISTOGRAM_BUCKETS] = {};
+    std::vector<GameEvent> events(simulation.GetEvents().GetCapacity());
+
+    InputPlayer player(recording);
+    InputSnapshot input;
+    auto start = Bench::Clock::now();
+    while (player.Next(input)) {
+        auto tickStart = Bench::Clock::now();
+        simulation.Tick(input, deltaTime);
+        double ms = Bench::ElapsedMs(tickStart);
+        latencies.push_back(ms);
+        histogram[BucketFor(ms * 1000.0)]++;
+        simulation.GetEvents().Drain(events.data(), (int)events.size());
+        clock.Advance(deltaTime * 1000.0);
+    }
+    double totalMs = Bench::ElapsedMs(start);
+
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](double p) {
+        if (latencies.empty()) return 0.0;
+        return latencies[(size_t)(p * (latencies.size() - 1))];
+    };
+
+    const Hero& hero = simulation.GetHero();
+    std::printf("file         %s\n", path);
+    std::printf("seed         %llu\n", (unsigned long long)recording.GetSeed());
+    std::printf("ticks        %zu\n", latencies.size());
+    std::printf("threads      %d\n", threads);
+    std::printf("total        %.2f ms (%.1f ticks/sec)\n", totalMs, latencies.size() / (totalMs / 1000.0));
+    std::printf("p50 / p99    %.4f / %.4f ms\n", percentile(0.50), percentile(0.99));
+    std::printf("max tick     %.4f ms\n", percentile(1.0));
+    std::printf("events       %u published, %u dropped\n",
+                simulation.GetEvents().GetPublished(), simulation.GetEvents().GetDropped());
+    std::printf("final state  alive=%d hero_level=%d kills=%d hp=%d\n",
+                simulation.GetMonsters().GetAliveCount(), hero.GetLevel(), hero.GetKills(), hero.GetCurrentHp());
+
+    std::printf("\n%-20s %8s\n", "tick time", "count");
+    int peak = *std::max_element(histogram, histogram + HISTOGRAM_BUCKETS);
+    for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+        if (histogram[i] == 0) continue;
+        char range[32];
+        std::snprintf(range, sizeof(range), "%u-%u us", i == 0 ? 0u : 1u << i, 1u << (i + 1));
+        int bar = peak > 0 ? histogram[i] * 40 / peak : 0;
+        std::printf("%-20s %8d %s\n", range, histogram[i], std::string(bar, '#').c_str());
+    }
+
+    if (histogramPath) {
+        FILE* file = std::fopen(histogramPath, "w");
+        if (!file) {
+            std::printf("failed to write %s\n", histogramPath);
+            return 1;
+        }
+        std::fprintf(file, "bucket_min_us,bucket_max_us,count\n");
+        for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+            std::fprintf(file, "%u,%u,%d\n", i == 0 ? 0u : 1u << i, 1u << (i + 1), histogram[i]);
+        }
+        std::fclose(file);
+    }
+    return 0;
+}
@@ -0,0 +1,166 @@
+#include "Bench.h"
+#include "DistanceKernels.h"
+#include "Random.h"
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+using namespace GameConstants;
+
+namespace {
+
+struct Points {
+    std::vector<float> xs;
+    std::vector<float> ys;
+};
+
+Points MakePoints(int count, uint64_t seed) {
+    Random rng(seed, 0);
+    Points points;
+    points.xs.resize(count);
+    points.ys.resize(count);
+    for (int i = 0; i < count; i++) {
+        points.xs[i] = rng.NextFloat() * MAP_WIDTH;
+        points.ys[i] = rng.NextFloat() * MAP_HEIGHT;
+    }
+    return points;
+}
+
+// 原本的寫法：逐點建立 Vector2D，以 DistanceTo（含開根號）比較半徑
+int QueryVector2D(const Points& points, Vector2D center, float radius, int* out) {
+    int hits = 0;
+    for (int i = 0; i < (int)points.xs.size(); i++) {
+        if (Vector2D(points.xs[i], points.ys[i]).DistanceTo(center) <= radius) {
+            out[hits++] = i;
+        }
+    }
+    return hits;
+}
+
+// 每個方法對多個中心各查詢一次，回傳每點耗時（奈秒）與命中總數
+template <typename Query>
+double Measure(int count, int centers, Query query, long long& totalHits) {
+    totalHits = 0;
+    auto start = Bench::Clock::now();
+    for (int c = 0; c < centers; c++) {
+        Vector2D center((float)(c * 397 % MAP_WIDTH), (float)(c * 211 % MAP_HEIGHT));
+        totalHits += query(center);
+    }
+    return Bench::ElapsedMs(start) * 1e6 / ((double)count * centers);
+}
+
+}
+
+// ============================================================================
+// 基準測試：批次距離核心
+// 參數：--radius R（預設 ATTACK_RANGE）、--seed S（預設 1）
+// 對連續座標陣列做半徑查詢：逐點 Vector2D::DistanceTo 對照純量 / SSE2 / AVX2 核心
+// （索引清單與位元遮罩兩種輸出），命中數必須一致
+// ============================================================================
+int RunSimdBench(int argc, char* argv[]) {
+    const float radius = (float)Bench::GetIntArg(argc, argv, "--radius", ATTACK_RANGE);
+    const int seed = Bench::GetIntArg(argc, argv, "--seed", 1);
+    const int counts[] = { 1000, 16000, 256000, 1000000 };
+    const SimdLevel host = GetHostSimdLevel();
+
+    std::printf("host SIMD %s, radius %.0f\n\n", GetSimdLevelName(host), radius);
+    std::printf("%-9s %-10s %-8s %10s %12s\n", "points", "method", "output", "ns/point", "hits");
+
+    for (int count : counts) {
+        Points points = MakePoints(count, (uint64_t)seed);
+        std::vector<int> indices(count);
+        std::vector<uint64_t> mask((count + 63) / 64);
+        // 小陣列多查幾次，讓每列的總工作量相近
+        int centers = std::max(16, 16000000 / count);
+
+        long long hits = 0;
+        double ns = Measure(count, centers, [&](Vector2D center) {
+            return QueryVector2D(points, center, radius, indices.data());
+        }, hits);
+        std::printf("%-9d %-10s %-8s %10.3f %12lld\n", count, "Vector2D", "indices", ns, hits);
+        const long long expected = hits;
+
+        for (int level = 0; level <= (int)host; level++) {
+            const DistanceKernels& kernels = GetDistanceKernels((SimdLevel)level);
+            const char* name = GetSimdLevelName((SimdLevel)level);
+
+            ns = Measure(count, centers, [&](Vector2D center) {
+                return kernels.radiusQuery(points.xs.data(), points.ys.data(), count,
+                                           center.x, center.y, radius * radius, indices.data());
+            }, hits);
+            std::printf("%-9d %-10s %-8s %10.3f %12lld%s\n", count, name, "indices", ns, hits,
+                        hits == expected ? "" : "  MISMATCH");
+
+            ns = Measure(count, centers, [&](Vector2D center) {
+                kernels.radiusMask(points.xs.data(), points.ys.data(), count,
+                                   center.x, center.y, radius * radius, mask.data());
+                int total = 0;
+                for (uint64_t word : mask) {
+                    for (; word; word &= word - 1) total++;
+                }
+                return total;
+            }, hits);
+            std::printf("%-9d %-10s %-8s %10.3f %12lld%s\n", count, name, "mask", ns, hits,
+                        hits == expected ? "" : "  MISMATCH");
+        }
+        std::printf("\n");
+    }
+
+    // 遊戲內的用法：網格先取出外接方框內的候選，再交給核心（與 SpatialGrid::QueryRadius 比較）
+    const int monsterCount = 10000;
+    const int queries = 200000;
+    Points monsters = MakePoints(monsterCount, (uint64_t)seed + 1);
+    SpatialGrid grid;
+    grid.Reserve(monsterCount);
+    for (int i = 0; i < monsterCount; i++) {
+        grid.Insert(i, Vector2D(monsters.xs[i], monsters.ys[i]));
+    }
+    std::vector<int> candidates;
+    std::vector<float> candidateX;
+    std::vector<float> candidateY;
+    std::vector<int> hitIndices;
+    candidates.reserve(monsterCount);
+    candidateX.reserve(monsterCount);
+    candidateY.reserve(monsterCount);
+    hitIndices.reserve(monsterCount);
+
+    std::printf("grid query, %d monsters, %d queries\n", monsterCount, queries);
+    std::printf("%-22s %10s %12s\n", "method", "ns/query", "hits");
+    long long gridHits = 0;
+    auto start = Bench::Clock::now();
+    for (int q = 0; q < queries; q++) {
+        Vector2D center((float)(q * 397 % MAP_WIDTH), (float)(q * 211 % MAP_HEIGHT));
+        candidates.clear();
+        grid.QueryRadius(center, radius, candidates);
+        gridHits += (long long)candidates.size();
+    }
+    std::printf("%-22s %10.1f %12lld\n", "QueryRadius", Bench::ElapsedMs(start) * 1e6 / queries, gridHits);
+
+    for (int level = 0; level <= (int)host; level++) {
+        const DistanceKernels& kernels = GetDistanceKernels((SimdLevel)level);
+        long long hits = 0;
+        start = Bench::Clock::now();
+        for (int q = 0; q < queries; q++) {
+            Vector2D center((float)(q * 397 % MAP_WIDTH), (float)(q * 211 % MAP_HEIGHT));
+            candidates.clear();
+            grid.QueryRect(center.x - radius, center.y - radius, center.x + radius, center.y + radius, candidates);
+            int count = (int)candidates.size();
+            candidateX.resize(count);
+            candidateY.resize(count);
+            hitIndices.resize(count);
+            for (int i = 0; i < count; i++) {
+                Vector2D pos = grid.GetPosition(candidates[i]);
+                candidateX[i] = pos.x;
+                candidateY[i] = pos.y;
+            }
+            hits += kernels.radiusQuery(candidateX.data(), candidateY.data(), count,
+                                        center.x, center.y, radius * radius, hitIndices.data());
+        }
+        char name[32];
+        std::snprintf(name, sizeof(name), "QueryRect + %s", GetSimdLevelName((SimdLevel)level));
+        std::printf("%-22s %10.1f %12lld%s\n", name, Bench::ElapsedMs(start) * 1e6 / queries, hits,
+                    hits == gridHits ? "" : "  MISMATCH");
+    }
+    return 0;
+}
@@ -0,0 +1,123 @@
+#include "Bench.h"
+#include "SpatialGrid.h"
+#include "SpawnPlacer.h"
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+using namespace GameConstants;
+
+namespace {
+
+const float LEFT = 50.0f;
+const float TOP = 50.0f;
+const float RIGHT = (float)(MAP_WIDTH - 50);
+const float BOTTOM = (float)(MAP_HEIGHT - 50);
+const Vector2D HERO_POS((float)MAP_WIDTH / 2, (float)MAP_HEIGHT / 2);
+
+struct PlacementStats {
+    double ms;
+    int placed;
+    float minDistance;       // 最近兩點的距離
+    int closePairs;          // 距離小於 spacing 的點對數
+};
+
+// 以網格統計最近距離與過近的點對
+void Measure(const std::vector<Vector2D>& points, float spacing, PlacementStats& stats) {
+    SpatialGrid grid(MAP_WIDTH, MAP_HEIGHT, std::max(4, (int)spacing));
+    grid.Reserve((int)points.size());
+    for (int i = 0; i < (int)points.size(); i++) {
+        grid.Insert(i, points[i]);
+    }
+
+    stats.minDistance = 2 * spacing;
+    stats.closePairs = 0;
+    std::vector<int> nearby;
+    for (int i = 0; i < (int)points.size(); i++) {
+        nearby.clear();
+        grid.QueryRadius(points[i], 2 * spacing, nearby);
+        for (int j : nearby) {
+            if (j <= i) continue;
+            float distance = points[i].DistanceTo(points[j]);
+            stats.minDistance = std::min(stats.minDistance, distance);
+            if (distance < spacing) stats.closePairs++;
+        }
+    }
+}
+
+// 原本的做法：拒絕取樣，只避開英雄，不檢查怪獸之間的距離
+PlacementStats RunRejection(int count, float spacing, uint64_t seed) {
+    Random rng(seed, (uint64_t)RandomStream::Spawn);
+    std::vector<Vector2D> points;
+    points.reserve(count);
+
+    auto start = Bench::Clock::now();
+    for (int i = 0; i < count; i++) {
+        Vector2D pos;
+        do {
+            pos.x = (float)(rng.NextInt(MAP_WIDTH - 100) + 50);
+            pos.y = (float)(rng.NextInt(MAP_HEIGHT - 100) + 50);
+        } while (pos.DistanceTo(HERO_POS) < SPAWN_SAFE_RADIUS);
+        points.push_back(pos);
+    }
+
+    PlacementStats stats;
+    stats.ms = Bench::ElapsedMs(start);
+    stats.placed = count;
+    Measure(points, spacing, stats);
+    return stats;
+}
+
+PlacementStats RunPlacer(int count, float spacing, uint64_t seed) {
+    Random rng(seed, (uint64_t)RandomStream::Spawn);
+    SpawnPlacer placer;
+    placer.SetBounds(LEFT, TOP, RIGHT, BOTTOM);
+    placer.SetMinSpacing(spacing);
+    std::vector<SpawnPoint> out;
+    out.reserve(count);
+
+    auto start = Bench::Clock::now();
+    placer.Begin();
+    placer.AddExclusion(HERO_POS, SPAWN_SAFE_RADIUS);
+    placer.Generate(count, rng, out);
+
+    PlacementStats stats;
+    stats.ms = Bench::ElapsedMs(start);
+    stats.placed = (int)out.size();
+
+    std::vector<Vector2D> points;
+    points.reserve(out.size());
+    for (const SpawnPoint& point : out) {
+        points.push_back(point.pos);
+    }
+    Measure(points, spacing, stats);
+    return stats;
+}
+
+void PrintRow(const char* method, int count, float spacing, const PlacementStats& stats) {
+    std::printf("%-10s %-9d %8.2f %10.3f %9d %10.2f %11d\n",
+                method, count, spacing, stats.ms, stats.placed, stats.minDistance, stats.closePairs);
+}
+
+}
+
+// ============================================================================
+// 基準測試：生成位置配置
+// 參數：--seed S（預設 1）、--spacing D（覆寫自動間距，用來測試空間不足時的終止）
+// 比較拒絕取樣與 Poisson-disk 配置的耗時、最近距離與過近點對數
+// ============================================================================
+int RunSpawnBench(int argc, char* argv[]) {
+    const int seed = Bench::GetIntArg(argc, argv, "--seed", 1);
+    const int spacingOverride = Bench::GetIntArg(argc, argv, "--spacing", 0);
+    const int counts[] = { 1000, 10000, 100000 };
+    const float area = (RIGHT - LEFT) * (BOTTOM - TOP) - 3.14159265f * SPAWN_SAFE_RADIUS * SPAWN_SAFE_RADIUS;
+
+    std::printf("%-10s %-9s %8s %10s %9s %10s %11s\n",
+                "method", "count", "spacing", "ms", "placed", "min dist", "close pairs");
+    for (int count : counts) {
+        float spacing = spacingOverride > 0 ? (float)spacingOverride : SpawnPlacer::FitSpacing(area, count);
+        PrintRow("rejection", count, spacing, RunRejection(count, spacing, (uint64_t)seed));
+        PrintRow("poisson", count, spacing, RunPlacer(count, spacing, (uint64_t)seed));
+    }
+    return 0;
+}
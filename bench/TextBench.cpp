@@ -0,0 +1,131 @@
+#include "Bench.h"
+#include "TextCacheIndex.h"
+#include "TextLabel.h"
+#include "Random.h"
+#include <algorithm>
+#include <cstdio>
+#include <cwchar>
+#include <vector>
+
+namespace {
+
+const int HUD_LINES = 20;
+const int HUD_VOLATILE = 6;      // 每幀都變的行（毫秒數、本幀計數）
+const int HUD_SLOW = 6;          // 約每 30 幀變一次的行（擊殺、剩餘怪獸）；其餘不變
+
+const uint64_t MONSTER_FONT = 1;
+const uint64_t HERO_FONT = 2;
+const uint64_t HUD_FONT = 3;
+
+struct TextResult {
+    double nsPerDraw;        // 格式化 + 快取查詢
+    double hitRate;
+    uint64_t evictions;
+    double formatsPerFrame;
+    double missesPerFrame;   // 需要重新點陣化的字串數
+    uint64_t allocations;
+};
+
+// 模擬一幀的文字：視野內的怪獸等級、英雄頭上兩行、HUD 各行
+// useLabels 為 false 時每個字串每幀都 swprintf（改版前的做法）
+TextResult RunFrames(int visibleMonsters, int frames, int capacity, bool useLabels, uint64_t seed) {
+    TextCacheIndex index(capacity);
+    std::vector<TextLabel> monsterLabels(10);
+    TextLabel heroLevel;
+    TextLabel heroHp;
+    std::vector<TextLabel> hudLabels(HUD_LINES);
+
+    Random rng(seed);
+    std::vector<int> levels(visibleMonsters);
+    for (int& level : levels) level = rng.Range(1, 9);
+
+    TextResult result = TextResult();
+    uint64_t formats = 0;
+    uint64_t draws = 0;
+    wchar_t text[TextLabel::MAX_LENGTH];
+
+    auto draw = [&](uint64_t font, uint32_t color, const wchar_t* str, int length) {
+        bool inserted;
+        index.Lookup(font, color, str, length, inserted);
+        draws++;
+    };
+    auto format = [&](TextLabel& label, uint64_t font, uint32_t color, const wchar_t* fmt, int a, int b) {
+        if (useLabels) {
+            if (label.Format(fmt, a, b)) formats++;
+            draw(font, color, label.GetText(), label.GetLength());
+        } else {
+            int length = std::swprintf(text, TextLabel::MAX_LENGTH, fmt, a, b);
+            formats++;
+            draw(font, color, text, length);
+        }
+    };
+
+    // 暖機一幀後才計算配置次數（標籤與索引在建構時已配置完畢）
+    uint64_t allocations = 0;
+    auto start = Bench::Clock::now();
+    for (int f = 0; f <= frames; f++) {
+        if (f == 1) {
+            allocations = Bench::AllocationCount();
+            start = Bench::Clock::now();
+            formats = 0;
+            draws = 0;
+            index.ResetStats();
+        }
+
+        // 偶爾有怪獸離開視野、新的進來
+        if (f % 15 == 0) levels[rng.NextInt(visibleMonsters)] = rng.Range(1, 9);
+        for (int level : levels) {
+            format(monsterLabels[level], MONSTER_FONT, 0x3232FF, L"Lv.%d", level, 0);
+        }
+
+        int hp = 100 - (f / 10) % 100;
+        format(heroLevel, HERO_FONT, 0x00D7FF, L"Lv.%d ★", 3 + f / 600, 0);
+        format(heroHp, HERO_FONT, 0xFFFFFF, L"%d/%d", hp, 100);
+
+        for (int line = 0; line < HUD_LINES; line++) {
+            int value = line < HUD_VOLATILE ? f * 7 + line
+                      : line < HUD_VOLATILE + HUD_SLOW ? f / 30 + line
+                      : line;
+            format(hudLabels[line], HUD_FONT, 0xC8C8C8, L"stat %d: %d", line, value);
+        }
+    }
+    double ms = Bench::ElapsedMs(start);
+
+    result.nsPerDraw = ms * 1e6 / std::max<uint64_t>(1, draws);
+    result.hitRate = index.GetHitRate();
+    result.evictions = index.GetEvictions();
+    result.formatsPerFrame = (double)formats / frames;
+    result.missesPerFrame = (double)index.GetMisses() / frames;
+    result.allocations = Bench::AllocationCount() - allocations;
+    return result;
+}
+
+}
+
+// ============================================================================
+// 基準測試：文字快取
+// 參數：--frames N（預設 3000）、--seed S（預設 1）
+// 比較每幀重新格式化所有字串與只在數值改變時格式化，並量不同容量下的 LRU 命中率；
+// 每次未命中在遊戲中代表一次 GDI 點陣化，命中則只需一次 AlphaBlend
+// ============================================================================
+int RunTextBench(int argc, char* argv[]) {
+    const int frames = std::max(1, Bench::GetIntArg(argc, argv, "--frames", 3000));
+    const uint64_t seed = (uint64_t)Bench::GetIntArg(argc, argv, "--seed", 1);
+    const int visibleCounts[] = { 50, 500 };
+    const int capacities[] = { 16, 32, 128 };
+
+    std::printf("%-8s %-9s %-7s %10s %9s %10s %13s %13s %7s\n", "visible", "capacity", "format",
+                "ns/draw", "hit rate", "evictions", "formats/frame", "rasters/frame", "allocs");
+    for (int visible : visibleCounts) {
+        for (int capacity : capacities) {
+            for (int labels = 0; labels < 2; labels++) {
+                TextResult r = RunFrames(visible, frames, capacity, labels != 0, seed);
+                std::printf("%-8d %-9d %-7s %10.1f %8.1f%% %10llu %13.1f %13.2f %7llu\n",
+                            visible, capacity, labels ? "label" : "always", r.nsPerDraw, r.hitRate * 100.0,
+                            (unsigned long long)r.evictions, r.formatsPerFrame, r.missesPerFrame,
+                            (unsigned long long)r.allocations);
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,117 @@
+#include "Bench.h"
+#include "ContentDatabase.h"
+#include "InputRecording.h"
+#include "Simulation.h"
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+// ============================================================================
+// 基準測試：固定步長模擬
+// 參數：--ticks N（預設 3600）、--monsters M（預設 10000）、--seed S（預設 1）、
+//       --record FILE（把腳本輸入存成錄製檔，供 replay 使用）
+// 英雄持續攻擊並繞圈移動，讓空間查詢與戰鬥路徑都被執行到；英雄陣亡時按空白鍵與 '1' 重新開局
+// 延遲分位數只統計遊戲進行中的步，重新開局（重新生成所有怪獸）的步不計入
+// ============================================================================
+int RunTickBench(int argc, char* argv[]) {
+    const int ticks = Bench::GetIntArg(argc, argv, "--ticks", 3600);
+    const int monsterCount = Bench::GetIntArg(argc, argv, "--monsters", 10000);
+    const int seed = Bench::GetIntArg(argc, argv, "--seed", 1);
+    const char* recordPath = Bench::GetStringArg(argc, argv, "--record", nullptr);
+    const float deltaTime = GameConstants::FIXED_TIMESTEP;
+    const double stepMs = deltaTime * 1000.0;
+
+    ManualClock clock;
+    Simulation simulation(&clock);
+    simulation.SetSeed((uint64_t)seed);
+    simulation.SetMonsterCount(monsterCount);
+    simulation.Reset();
+
+    InputRecording recording;
+    recording.Begin((uint64_t)seed, monsterCount, ContentDatabase::GetDefault().GetContentHash());
+
+    // 第一步按下 '1' 選劍，錄製檔重播時才會走相同的選單流程
+    InputSnapshot select;
+    select.SetKey('1', true);
+    recording.RecordTick(select);
+    simulation.Tick(select, deltaTime);
+    clock.Advance(stepMs);
+
+    const int moveKeys[] = { KeyCodes::RIGHT, KeyCodes::DOWN, KeyCodes::LEFT, KeyCodes::UP };
+    std::vector<double> latencies;
+    latencies.reserve(ticks);
+
+    // 每步取出事件，模擬畫面端的消費者
+    std::vector<GameEvent> events(simulation.GetEvents().GetCapacity());
+    int eventCounts[4] = {};
+
+    uint64_t allocations = 0;
+    int rounds = 1;
+    auto start = Bench::Clock::now();
+    for (int t = 0; t < ticks; t++) {
+        InputSnapshot input;
+        input.SetKey('A', true);
+        input.SetKey(moveKeys[(t / 120) % 4], true);
+        if (simulation.GetState() == GameState::GameOver || simulation.GetState() == GameState::Victory) {
+            input.SetKey(KeyCodes::SPACE, true);
+            rounds++;
+        } else if (simulation.GetState() == GameState::WeaponSelect) {
+            input.SetKey('1', true);
+        }
+
+        recording.RecordTick(input);
+        bool playing = simulation.GetState() == GameState::Playing;
+        uint64_t allocationsBefore = Bench::AllocationCount();
+        auto tickStart = Bench::Clock::now();
+        simulation.Tick(input, deltaTime);
+        double tickMs = Bench::ElapsedMs(tickStart);
+        int count = simulation.GetEvents().Drain(events.data(), (int)events.size());
+        for (int i = 0; i < count; i++) {
+            eventCounts[(int)events[i].type]++;
+        }
+        // 延遲與配置都只計遊戲進行中的步：結束畫面按下空白鍵的那一步會重新生成所有怪獸，
+        // 選武器會複製名稱字串，兩者都不是穩定遊戲中的成本
+        if (playing) {
+            latencies.push_back(tickMs);
+            allocations += Bench::AllocationCount() - allocationsBefore;
+        }
+
+        clock.Advance(stepMs);
+    }
+    double totalMs = Bench::ElapsedMs(start);
+
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&](double p) {
+        if (latencies.empty()) return 0.0;
+        size_t index = (size_t)(p * (latencies.size() - 1));
+        return latencies[index];
+    };
+
+    std::printf("ticks        %d\n", ticks);
+    std::printf("monsters     %d (alive at end: %d, wave %d, kills %d)\n",
+                monsterCount, simulation.GetMonsters().GetAliveCount(),
+                simulation.GetWave(), simulation.GetHero().GetKills());
+    std::printf("rounds       %d (restarted after game over)\n", rounds);
+    std::printf("flow field   %d rebuilds (last %.3f ms)\n",
+                simulation.GetFlowField().GetRebuildCount(), simulation.GetFlowField().GetLastBuildMs());
+    std::printf("events       %d damage, %d kills, %d level-ups, %d state changes (%u dropped)\n",
+                eventCounts[(int)GameEventType::DamageDealt], eventCounts[(int)GameEventType::MonsterKilled],
+                eventCounts[(int)GameEventType::LevelUp], eventCounts[(int)GameEventType::StateChanged],
+                simulation.GetEvents().GetDropped());
+    std::printf("ticks/sec    %.1f (all ticks, including restarts)\n", ticks / (totalMs / 1000.0));
+    std::printf("playing      %d ticks timed (%d menu / restart ticks excluded)\n",
+                (int)latencies.size(), ticks - (int)latencies.size());
+    std::printf("p50 tick     %.4f ms\n", percentile(0.50));
+    std::printf("p99 tick     %.4f ms\n", percentile(0.99));
+    std::printf("max tick     %.4f ms\n", percentile(1.0));
+    std::printf("allocations  %llu inside playing ticks\n", (unsigned long long)allocations);
+
+    if (recordPath) {
+        if (!recording.Save(recordPath)) {
+            std::printf("failed to write %s\n", recordPath);
+            return 1;
+        }
+        std::printf("recorded     %s (%u ticks)\n", recordPath, recording.GetTickCount());
+    }
+    return 0;
+}
@@ -0,0 +1,153 @@
+#include "BackgroundLayer.h"
+#include <algorithm>
+
+using namespace GameConstants;
+
+BackgroundLayer::BackgroundLayer(GdiCache* cache)
+    : cache_(cache)
+    , mapWidth_(0)
+    , mapHeight_(0)
+    , chunkWidth_(0)
+    , chunkHeight_(0)
+    , chunksX_(0)
+    , chunksY_(0)
+    , capacity_(0)
+    , frame_(0)
+    , blitCount_(0)
+{
+}
+
+BackgroundLayer::~BackgroundLayer() {
+    Release();
+}
+
+void BackgroundLayer::Initialize(int mapWidth, int mapHeight, int viewWidth, int viewHeight) {
+    Release();
+    
+    mapWidth_ = mapWidth;
+    mapHeight_ = mapHeight;
+    
+    if (mapWidth <= MAX_SINGLE_CHUNK && mapHeight <= MAX_SINGLE_CHUNK) {
+        chunkWidth_ = mapWidth;
+        chunkHeight_ = mapHeight;
+    } else {
+        chunkWidth_ = CHUNK_SIZE;
+        chunkHeight_ = CHUNK_SIZE;
+    }
+    
+    chunksX_ = (mapWidth + chunkWidth_ - 1) / chunkWidth_;
+    chunksY_ = (mapHeight + chunkHeight_ - 1) / chunkHeight_;
+    
+    // 視野最多同時跨越的區塊數，再多留一圈給捲動時使用
+    int visibleX = std::min(chunksX_, viewWidth / chunkWidth_ + 2);
+    int visibleY = std::min(chunksY_, viewHeight / chunkHeight_ + 2);
+    capacity_ = std::min(chunksX_ * chunksY_, (visibleX + 1) * (visibleY + 1));
+    chunks_.reserve(capacity_);
+}
+
+void BackgroundLayer::Release() {
+    for (auto& chunk : chunks_) {
+        SelectObject(chunk.dc, chunk.oldBitmap);
+        DeleteObject(chunk.bitmap);
+        DeleteDC(chunk.dc);
+    }
+    chunks_.clear();
+}
+
+BackgroundLayer::Chunk* BackgroundLayer::AcquireChunk(int chunkX, int chunkY) {
+    for (auto& chunk : chunks_) {
+        if (chunk.chunkX == chunkX && chunk.chunkY == chunkY) {
+            chunk.lastUsed = frame_;
+            return &chunk;
+        }
+    }
+    
+    Chunk* target = nullptr;
+    if ((int)chunks_.size() < capacity_) {
+        HDC screenDC = GetDC(NULL);
+        Chunk chunk = {};
+        chunk.dc = CreateCompatibleDC(screenDC);
+        chunk.bitmap = CreateCompatibleBitmap(screenDC, chunkWidth_, chunkHeight_);
+        chunk.oldBitmap = (HBITMAP)SelectObject(chunk.dc, chunk.bitmap);
+        ReleaseDC(NULL, screenDC);
+        
+        chunks_.push_back(chunk);
+        target = &chunks_.back();
+    } else {
+        // 重用最久未使用的區塊
+        target = &*std::min_element(chunks_.begin(), chunks_.end(),
+            [](const Chunk& a, const Chunk& b) { return a.lastUsed < b.lastUsed; });
+    }
+    
+    target->chunkX = chunkX;
+    target->chunkY = chunkY;
+    target->lastUsed = frame_;
+    RenderChunk(*target);
+    return target;
+}
+
+void BackgroundLayer::RenderChunk(Chunk& chunk) {
+    HDC dc = chunk.dc;
+    int originX = chunk.chunkX * chunkWidth_;
+    int originY = chunk.chunkY * chunkHeight_;
+    
+    RECT fullRect = { 0, 0, chunkWidth_, chunkHeight_ };
+    FillRect(dc, &fullRect, cache_->GetBrush(RGB(40, 40, 50)));
+    
+    HBRUSH grass1 = cache_->GetBrush(RGB(50, 120, 50));
+    HBRUSH grass2 = cache_->GetBrush(RGB(45, 110, 45));
+    
+    int right = std::min(originX + chunkWidth_, mapWidth_);
+    int bottom = std::min(originY + chunkHeight_, mapHeight_);
+    int startTileX = originX / TILE_SIZE;
+    int startTileY = originY / TILE_SIZE;
+    int endTileX = (right + TILE_SIZE - 1) / TILE_SIZE;
+    int endTileY = (bottom + TILE_SIZE - 1) / TILE_SIZE;
+    
+    for (int ty = startTileY; ty < endTileY; ty++) {
+        for (int tx = startTileX; tx < endTileX; tx++) {
+            int tileX = tx * TILE_SIZE;
+            int tileY = ty * TILE_SIZE;
+            
+            RECT tileRect = {
+                tileX - originX,
+                tileY - originY,
+                std::min(tileX + TILE_SIZE, right) - originX,
+                std::min(tileY + TILE_SIZE, bottom) - originY
+            };
+            FillRect(dc, &tileRect, ((tx + ty) % 2 == 0) ? grass1 : grass2);
+        }
+    }
+    
+    HPEN borderPen = cache_->GetPen(PS_SOLID, 3, RGB(100, 50, 0));
+    HPEN oldPen = (HPEN)SelectObject(dc, borderPen);
+    HBRUSH oldBrush = (HBRUSH)SelectObject(dc, GetStockObject(NULL_BRUSH));
+    
+    Rectangle(dc, -originX, -originY, mapWidth_ - originX, mapHeight_ - originY);
+    
+    SelectObject(dc, oldPen);
+    SelectObject(dc, oldBrush);
+}
+
+void BackgroundLayer::Draw(HDC hdc, Vector2D cameraOffset, int viewWidth, int viewHeight) {
+    frame_++;
+    blitCount_ = 0;
+    if (chunkWidth_ <= 0 || chunkHeight_ <= 0) return;
+    
+    int cameraX = (int)cameraOffset.x;
+    int cameraY = (int)cameraOffset.y;
+    
+    int firstX = std::max(0, cameraX / chunkWidth_);
+    int firstY = std::max(0, cameraY / chunkHeight_);
+    int lastX = std::min(chunksX_ - 1, (cameraX + viewWidth - 1) / chunkWidth_);
+    int lastY = std::min(chunksY_ - 1, (cameraY + viewHeight - 1) / chunkHeight_);
+    
+    for (int cy = firstY; cy <= lastY; cy++) {
+        for (int cx = firstX; cx <= lastX; cx++) {
+            Chunk* chunk = AcquireChunk(cx, cy);
+            BitBlt(hdc, cx * chunkWidth_ - cameraX, cy * chunkHeight_ - cameraY,
+                   chunkWidth_, chunkHeight_, chunk->dc, 0, 0, SRCCOPY);
+            blitCount_++;
+        }
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+#include <windows.h>
+#include "GdiCache.h"
+#include "Types.h"
+#include <vector>
+
+// ============================================================================
+// 預先繪製的背景圖層
+// 地圖格子只在建立區塊時畫一次，之後每幀只需 BitBlt 可見區塊
+// 地圖不大時整張地圖就是一個區塊（每幀一次 BitBlt）；
+// 大地圖則切成固定大小的區塊，以環狀快取保留最近使用的區塊
+// ============================================================================
+class BackgroundLayer {
+private:
+    struct Chunk {
+        int chunkX;              // 區塊座標
+        int chunkY;
+        HDC dc;                  // 區塊記憶體 DC
+        HBITMAP bitmap;
+        HBITMAP oldBitmap;
+        unsigned int lastUsed;   // 最後使用的幀編號
+    };
+
+    GdiCache* cache_;            // 共用的 GDI 物件快取
+    int mapWidth_;
+    int mapHeight_;
+    int chunkWidth_;
+    int chunkHeight_;
+    int chunksX_;                // 橫向區塊數
+    int chunksY_;                // 縱向區塊數
+    int capacity_;               // 環狀快取可保留的區塊數
+    std::vector<Chunk> chunks_;
+    unsigned int frame_;
+    int blitCount_;              // 上一幀的 BitBlt 次數
+
+    Chunk* AcquireChunk(int chunkX, int chunkY);
+    void RenderChunk(Chunk& chunk);
+
+public:
+    static constexpr int MAX_SINGLE_CHUNK = 2048;   // 單一區塊的最大邊長
+    static constexpr int CHUNK_SIZE = 1024;         // 大地圖的區塊邊長
+
+    explicit BackgroundLayer(GdiCache* cache);
+    ~BackgroundLayer();
+
+    BackgroundLayer(const BackgroundLayer&) = delete;
+    BackgroundLayer& operator=(const BackgroundLayer&) = delete;
+
+    // 設定地圖與視窗大小（會釋放既有區塊）
+    void Initialize(int mapWidth, int mapHeight, int viewWidth, int viewHeight);
+    void Release();
+
+    // 繪製目前視野
+    void Draw(HDC hdc, Vector2D cameraOffset, int viewWidth, int viewHeight);
+
+    // 統計資訊
+    int GetBlitCount() const { return blitCount_; }
+    int GetChunkCount() const { return (int)chunks_.size(); }
+};
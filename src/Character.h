@@ -7,6 +7,7 @@
 class Character {
 protected:
     Vector2D position_;      // 位置
+    Vector2D previousPosition_;  // 上一個模擬步的位置（繪製內插用）
     int level_;              // 等級
     int maxHp_;              // 最大生命值
     int currentHp_;          // 當前生命值
@@ -22,7 +23,7 @@ public:
     
     // 基本屬性存取
     Vector2D GetPosition() const { return position_; }
-    void SetPosition(Vector2D pos) { position_ = pos; }
+    void SetPosition(Vector2D pos) { position_ = pos; previousPosition_ = pos; }
     int GetLevel() const { return level_; }
     int GetMaxHp() const { return maxHp_; }
     int GetCurrentHp() const { return currentHp_; }
@@ -31,15 +32,17 @@ public:
     bool IsAlive() const { return isAlive_; }
     Direction GetFacing() const { return facing_; }
     
-    // 行為方法
+    // 繪製內插：每個模擬步開始前保存位置，繪製時依 alpha 混合
+    void StorePreviousPosition() { previousPosition_ = position_; }
+    Vector2D GetInterpolatedPosition(float alpha) const {
+        return previousPosition_ + (position_ - previousPosition_) * alpha;
+    }
+    
+    // 行為方法（移動速度的單位為每個模擬步的像素數）
     virtual void Move(Direction dir);
     virtual void TakeDamage(int damage);
     virtual void Update(float deltaTime);
     
-    // 繪製方法（純虛函數，由子類別實作）
-    virtual void Draw(HDC hdc, Vector2D cameraOffset) = 0;
-    virtual void DrawStatus(HDC hdc, Vector2D cameraOffset) = 0;
-    
     // 計算與其他角色的距離
     float DistanceTo(const Character& other) const;
     
@@ -54,20 +57,23 @@ class Hero : public Character {
 private:
     WeaponStats weapon_;         // 武器
     int experience_;             // 經驗值
-    DWORD lastAttackTime_;       // 上次攻擊時間
+    uint32_t lastAttackTime_;    // 上次攻擊時間（毫秒）
     bool isAttacking_;           // 是否正在攻擊
     int kills_;                  // 擊殺數
     
 public:
     Hero(Vector2D pos);
     
+    // 重新開局：就地還原所有狀態，不重新配置物件
+    void Reset(Vector2D pos);
+    
     // 武器相關
-    void SetWeapon(WeaponType type);
-    WeaponStats GetWeapon() const { return weapon_; }
+    void SetWeapon(const WeaponStats& weapon) { weapon_ = weapon; }
+    const WeaponStats& GetWeapon() const { return weapon_; }
     
-    // 攻擊相關
-    bool CanAttack() const;
-    int PerformAttack();
+    // 攻擊相關（currentTime 由模擬時鐘提供，單位毫秒）
+    bool CanAttack(uint32_t currentTime) const;
+    int PerformAttack(uint32_t currentTime);
     void StartAttack() { isAttacking_ = true; }
     void EndAttack() { isAttacking_ = false; }
     bool IsAttacking() const { return isAttacking_; }
@@ -77,37 +83,5 @@ public:
     void LevelUp();
     int GetKills() const { return kills_; }
     void AddKill() { kills_++; }
-    
-    // 繪製
-    void Draw(HDC hdc, Vector2D cameraOffset) override;
-    void DrawStatus(HDC hdc, Vector2D cameraOffset) override;
-    void DrawWeapon(HDC hdc, Vector2D screenPos);
-};
-
-// ============================================================================
-// 怪獸類別
-// ============================================================================
-class Monster : public Character {
-private:
-    COLORREF bodyColor_;         // 身體顏色
-    int experienceReward_;       // 擊殺獎勵經驗
-    float wanderTimer_;          // 漫遊計時器
-    Direction wanderDirection_;  // 漫遊方向
-    
-public:
-    Monster(Vector2D pos, int level);
-    
-    // 怪獸特有行為
-    void Wander(float deltaTime);
-    int GetExperienceReward() const { return experienceReward_; }
-    
-    // 根據等級生成顏色
-    static COLORREF GetColorByLevel(int level);
-    
-    // 繪製
-    void Draw(HDC hdc, Vector2D cameraOffset) override;
-    void DrawStatus(HDC hdc, Vector2D cameraOffset) override;
-    
-    // 更新
-    void Update(float deltaTime) override;
+    void AddKills(int count) { kills_ += count; }
 };
@@ -0,0 +1,46 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+// ============================================================================
+// 時鐘介面（由外部注入模擬核心，方便無視窗執行與重現）
+// ============================================================================
+class Clock {
+public:
+    virtual ~Clock() = default;
+
+    // 目前時間（毫秒）
+    virtual uint32_t NowMs() const = 0;
+};
+
+// ============================================================================
+// 系統時鐘：以 steady_clock 為基準
+// ============================================================================
+class SteadyClock : public Clock {
+private:
+    std::chrono::steady_clock::time_point start_;
+
+public:
+    SteadyClock() : start_(std::chrono::steady_clock::now()) {}
+
+    uint32_t NowMs() const override {
+        auto elapsed = std::chrono::steady_clock::now() - start_;
+        return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+    }
+};
+
+// ============================================================================
+// 手動時鐘：由呼叫端推進，用於固定步長模擬與基準測試
+// ============================================================================
+class ManualClock : public Clock {
+private:
+    double nowMs_;
+
+public:
+    ManualClock() : nowMs_(0) {}
+
+    void Advance(double ms) { nowMs_ += ms; }
+    void Reset() { nowMs_ = 0; }
+
+    uint32_t NowMs() const override { return (uint32_t)nowMs_; }
+};
@@ -0,0 +1,275 @@
+#include "CollisionSystem.h"
+#include "Character.h"
+#include "JobSystem.h"
+#include "MonsterPool.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace GameConstants;
+
+namespace {
+
+const float MONSTER_DIAMETER = (float)MONSTER_SIZE;
+const float MONSTER_DIAMETER_SQ = MONSTER_DIAMETER * MONSTER_DIAMETER;
+
+double ToMs(uint64_t startNs, uint64_t endNs) {
+    return (endNs - startNs) / 1e6;
+}
+
+}
+
+CollisionSystem::CollisionSystem(int worldWidth, int worldHeight, int cellSize)
+    : cellSize_(std::max(cellSize, MONSTER_SIZE))
+    , budget_(DEFAULT_BUDGET)
+    , cursor_(0)
+    , kernels_(&GetDistanceKernels(GetHostSimdLevel()))
+    , stats_()
+{
+    // 格子不小於怪獸直徑，會重疊的兩隻怪獸必定落在相鄰格
+    cols_ = (worldWidth + cellSize_ - 1) / cellSize_;
+    rows_ = (worldHeight + cellSize_ - 1) / cellSize_;
+    cellStart_.assign(cols_ * rows_ + 1, 0);
+}
+
+void CollisionSystem::Reserve(int capacity) {
+    cellOf_.resize(capacity);
+    sortedIds_.resize(capacity);
+    sortedIndexOf_.assign(capacity, -1);
+    resolveIds_.reserve(capacity);
+    sortedX_.resize(capacity);
+    sortedY_.resize(capacity);
+    offsetX_.resize(capacity);
+    offsetY_.resize(capacity);
+    chunkCandidates_.resize((capacity + RESOLVE_CHUNK - 1) / RESOLVE_CHUNK);
+    chunkContacts_.resize(chunkCandidates_.size());
+    heroContacts_.reserve(capacity);
+    cursor_ = 0;
+}
+
+int CollisionSystem::CellOf(float x, float y) const {
+    int cx = std::max(0, std::min((int)(x / cellSize_), cols_ - 1));
+    int cy = std::max(0, std::min((int)(y / cellSize_), rows_ - 1));
+    return cy * cols_ + cx;
+}
+
+void CollisionSystem::BuildCells(const MonsterPool& monsters) {
+    const int count = monsters.GetAliveCount();
+    const int cellCount = cols_ * rows_;
+    const int* ids = monsters.GetActiveIds();
+    const float* posX = monsters.GetPositionsX();
+    const float* posY = monsters.GetPositionsY();
+
+    // 計數排序：先數每格數量，轉成每格的結尾，再由後往前填入（同格內保持存活順序）
+    std::fill(cellStart_.begin(), cellStart_.end(), 0);
+    for (int i = 0; i < count; i++) {
+        int cell = CellOf(posX[ids[i]], posY[ids[i]]);
+        cellOf_[i] = cell;
+        cellStart_[cell]++;
+    }
+    for (int cell = 1; cell < cellCount; cell++) {
+        cellStart_[cell] += cellStart_[cell - 1];
+    }
+    cellStart_[cellCount] = count;
+
+    std::fill(sortedIndexOf_.begin(), sortedIndexOf_.end(), -1);
+    for (int i = count - 1; i >= 0; i--) {
+        int k = --cellStart_[cellOf_[i]];
+        int id = ids[i];
+        sortedIds_[k] = id;
+        sortedIndexOf_[id] = k;
+        sortedX_[k] = posX[id];
+        sortedY_[k] = posY[id];
+    }
+}
+
+// 處理 resolveIds_ 中 [begin, end) 的怪獸
+void CollisionSystem::ResolveRange(int begin, int end, int& candidates, int& contacts) {
+    const int BLOCK = 64;
+    int hitIndices[BLOCK];
+    for (int i = begin; i < end; i++) {
+        const int id = resolveIds_[i];
+        const int k = sortedIndexOf_[id];
+        const float x = sortedX_[k];
+        const float y = sortedY_[k];
+        const int cell = CellOf(x, y);
+        const int cx = cell % cols_;
+        const int cy = cell / cols_;
+        const int left = std::max(cx - 1, 0);
+        const int right = std::min(cx + 1, cols_ - 1);
+
+        float pushX = 0;
+        float pushY = 0;
+        for (int row = std::max(cy - 1, 0); row <= std::min(cy + 1, rows_ - 1); row++) {
+            // 同一列相鄰三格在排序陣列中連續
+            const int from = cellStart_[row * cols_ + left];
+            const int to = cellStart_[row * cols_ + right + 1];
+            candidates += to - from;
+
+            // 距離測試交給批次核心，每次 64 隻，只對命中者計算推力
+            for (int block = from; block < to; block += BLOCK) {
+                int hits = kernels_->radiusQuery(&sortedX_[block], &sortedY_[block], std::min(BLOCK, to - block),
+                                                 x, y, MONSTER_DIAMETER_SQ, hitIndices);
+                for (int h = 0; h < hits; h++) {
+                    int j = block + hitIndices[h];
+                    float dx = x - sortedX_[j];
+                    float dy = y - sortedY_[j];
+                    float distSq = dx * dx + dy * dy;
+                    if (distSq >= MONSTER_DIAMETER_SQ || j == k) continue;
+
+                    contacts++;
+                    if (distSq > 1e-6f) {
+                        float dist = std::sqrt(distSq);
+                        float scale = (MONSTER_DIAMETER - dist) * 0.5f / dist;
+                        pushX += dx * scale;
+                        pushY += dy * scale;
+                    } else {
+                        // 完全重疊時依 ID 決定方向，兩隻往相反方向推開
+                        pushX += (id < sortedIds_[j] ? -0.5f : 0.5f) * MONSTER_DIAMETER;
+                    }
+                }
+            }
+        }
+        candidates--;        // 扣掉自己
+
+        // 擠在一起的群體各方向的推力疊加後可能很大，限制每步位移避免抖動
+        float pushSq = pushX * pushX + pushY * pushY;
+        if (pushSq > MAX_PUSH * MAX_PUSH) {
+            float scale = MAX_PUSH / std::sqrt(pushSq);
+            pushX *= scale;
+            pushY *= scale;
+        }
+        offsetX_[k] = pushX;
+        offsetY_[k] = pushY;
+    }
+}
+
+// 第 k 隻（排序後索引）的鄰格怪獸數，即窄相位的測試次數（含自己）
+int CollisionSystem::CountCandidates(int k) const {
+    const int cell = CellOf(sortedX_[k], sortedY_[k]);
+    const int cx = cell % cols_;
+    const int cy = cell / cols_;
+    const int left = std::max(cx - 1, 0);
+    const int right = std::min(cx + 1, cols_ - 1);
+    int candidates = 0;
+    for (int row = std::max(cy - 1, 0); row <= std::min(cy + 1, rows_ - 1); row++) {
+        candidates += cellStart_[row * cols_ + right + 1] - cellStart_[row * cols_ + left];
+    }
+    return candidates;
+}
+
+// 從游標起依槽位 ID 順序（越過容量繞回 0）挑出預算內的存活怪獸放進 resolveIds_，並把游標移到下一隻；
+// 至少處理一隻，避免游標停滯
+void CollisionSystem::SelectBatch(int capacity) {
+    resolveIds_.clear();
+    int id = cursor_ < capacity ? cursor_ : 0;
+    long long spent = 0;
+    for (int visited = 0; visited < capacity; visited++) {
+        const int k = sortedIndexOf_[id];
+        if (k >= 0) {
+            if (budget_ > 0) {
+                spent += CountCandidates(k);
+                if (spent > budget_ && !resolveIds_.empty()) break;
+            }
+            resolveIds_.push_back(id);
+        }
+        id = id + 1 < capacity ? id + 1 : 0;
+    }
+    cursor_ = id;
+}
+
+void CollisionSystem::ResolveHero(MonsterPool& monsters, const Hero& hero) {
+    if (!hero.IsAlive()) return;
+
+    // 以怪獸左上角座標表示英雄中心，兩者都以中心比較距離
+    const float halfMonster = MONSTER_SIZE * 0.5f;
+    const Vector2D heroPos = hero.GetPosition();
+    const float centerX = heroPos.x + hero.GetSize() * 0.5f - halfMonster;
+    const float centerY = heroPos.y + hero.GetSize() * 0.5f - halfMonster;
+    const float minDist = (hero.GetSize() + MONSTER_SIZE) * 0.5f;
+
+    // 格子依分離前的位置建立，搜尋範圍多留 MAX_PUSH
+    const float reach = minDist + MAX_PUSH;
+    const int first = CellOf(centerX - reach, centerY - reach);
+    const int last = CellOf(centerX + reach, centerY + reach);
+    const int left = first % cols_;
+    const int right = last % cols_;
+    for (int row = first / cols_; row <= last / cols_; row++) {
+        const int from = cellStart_[row * cols_ + left];
+        const int to = cellStart_[row * cols_ + right + 1];
+        for (int k = from; k < to; k++) {
+            int id = sortedIds_[k];
+            Vector2D pos = monsters.GetPosition(id);
+            float dx = pos.x - centerX;
+            float dy = pos.y - centerY;
+            float distSq = dx * dx + dy * dy;
+            if (distSq >= minDist * minDist) continue;
+
+            stats_.heroContacts++;
+            heroContacts_.push_back(id);
+            if (distSq > 1e-6f) {
+                float dist = std::sqrt(distSq);
+                float scale = (minDist - dist) / dist;
+                monsters.Displace(id, Vector2D(dx * scale, dy * scale));
+            } else {
+                monsters.Displace(id, Vector2D(0, minDist));
+            }
+        }
+    }
+}
+
+void CollisionSystem::Resolve(MonsterPool& monsters, const Hero& hero, JobSystem* jobs) {
+    stats_ = CollisionStats();
+    heroContacts_.clear();
+    resolveIds_.clear();
+    const int count = monsters.GetAliveCount();
+    stats_.monsters = count;
+    if (count == 0) return;
+
+    uint64_t startNs = Profiler::NowNs();
+    BuildCells(monsters);
+    uint64_t broadNs = Profiler::NowNs();
+
+    // 從游標開始處理預算內的 resolveCount 隻
+    SelectBatch(monsters.GetCapacity());
+    const int resolveCount = (int)resolveIds_.size();
+    auto resolveChunk = [&](int begin, int end, int chunk) {
+        int candidates = 0;
+        int contacts = 0;
+        ResolveRange(begin, end, candidates, contacts);
+        chunkCandidates_[chunk] = candidates;
+        chunkContacts_[chunk] = contacts;
+    };
+
+    const int chunkCount = (resolveCount + RESOLVE_CHUNK - 1) / RESOLVE_CHUNK;
+    if (jobs) {
+        jobs->ParallelFor(resolveCount, RESOLVE_CHUNK, resolveChunk);
+    } else {
+        for (int chunk = 0; chunk < chunkCount; chunk++) {
+            resolveChunk(chunk * RESOLVE_CHUNK, std::min(resolveCount, (chunk + 1) * RESOLVE_CHUNK), chunk);
+        }
+    }
+    int contacts = 0;
+    for (int chunk = 0; chunk < chunkCount; chunk++) {
+        stats_.candidates += chunkCandidates_[chunk];
+        contacts += chunkContacts_[chunk];
+    }
+    stats_.contacts = contacts / 2;      // 每對在兩端各計一次
+    stats_.resolved = resolveCount;
+    uint64_t narrowNs = Profiler::NowNs();
+
+    // 套用位移（位移都依分離前的位置算出，結果與處理順序及執行緒數無關）
+    for (int i = 0; i < resolveCount; i++) {
+        int id = resolveIds_[i];
+        int k = sortedIndexOf_[id];
+        if (offsetX_[k] != 0 || offsetY_[k] != 0) {
+            monsters.Displace(id, Vector2D(offsetX_[k], offsetY_[k]));
+        }
+    }
+    ResolveHero(monsters, hero);
+    uint64_t endNs = Profiler::NowNs();
+
+    stats_.broadMs = ToMs(startNs, broadNs);
+    stats_.narrowMs = ToMs(broadNs, narrowNs);
+    stats_.applyMs = ToMs(narrowNs, endNs);
+}
@@ -0,0 +1,88 @@
+#pragma once
+#include "DistanceKernels.h"
+#include "Types.h"
+#include <cstdint>
+#include <vector>
+
+class Hero;
+class JobSystem;
+class MonsterPool;
+
+// ============================================================================
+// 碰撞統計（最近一次 Resolve）
+// ============================================================================
+struct CollisionStats {
+    int monsters;            // 參與的存活怪獸數
+    int resolved;            // 本步完成窄相位的怪獸數（超出預算的留到下一步）
+    int candidates;          // 窄相位距離測試次數
+    int contacts;            // 重疊的怪獸對數
+    int heroContacts;        // 與英雄重疊的怪獸數
+    double broadMs;          // 寬相位：依格子計數排序
+    double narrowMs;         // 窄相位：計算分離位移
+    double applyMs;          // 套用位移並同步空間索引
+};
+
+// ============================================================================
+// 怪獸碰撞處理
+// 寬相位：每步以計數排序把存活怪獸依格子（邊長為怪獸直徑）重新排列成連續陣列，
+//         同一列相鄰三格在陣列中是連續的一段，鄰格掃描只需三次線性走訪
+// 窄相位：距離測試使用批次距離核心；每隻怪獸只讀取鄰居、只寫自己的位移（圓形分離，各推開一半重疊量），
+//         結果與處理順序及執行緒數無關，可分區塊平行
+// 預算以每步窄相位的距離測試次數計：耗時與測試次數成正比，又不依賴計時，重播才能重現；
+// 寬相位算出每隻怪獸的測試次數後，從輪替游標（怪獸槽位 ID）起依 ID 順序取到預算用完為止，
+// 其餘留到之後的步；游標不受每步重新排序影響，每隻存活怪獸最多等待一輪就會被處理
+// 英雄周圍的怪獸不受預算限制，每步都會被完整推出英雄範圍
+// ============================================================================
+class CollisionSystem {
+public:
+    static constexpr int DEFAULT_BUDGET = 1 << 19;       // 每步窄相位的距離測試次數上限
+    static constexpr int RESOLVE_CHUNK = 1024;           // 平行窄相位的區塊大小
+    static constexpr float MAX_PUSH = GameConstants::MONSTER_SIZE * 0.25f;   // 每步最大分離位移
+
+private:
+    int cellSize_;
+    int cols_;
+    int rows_;
+    int budget_;                             // 每步的距離測試次數上限（0 表示不限）
+    int cursor_;                             // 超出預算時下一批的起點（怪獸槽位 ID）
+    std::vector<int> cellStart_;             // 每格在排序陣列中的起點（cols * rows + 1 個）
+    std::vector<int> cellOf_;                // 排序前：每隻存活怪獸的格子
+    std::vector<int> sortedIds_;             // 依格子排序的怪獸 ID
+    std::vector<int> sortedIndexOf_;         // 每個槽位 ID 在排序陣列中的索引（未存活為 -1）
+    std::vector<int> resolveIds_;            // 本步在預算內處理的怪獸 ID（依游標順序）
+    std::vector<float> sortedX_;             // 依格子排序的座標
+    std::vector<float> sortedY_;
+    std::vector<float> offsetX_;             // 窄相位結果（依排序後索引）
+    std::vector<float> offsetY_;
+    std::vector<int> chunkCandidates_;       // 各區塊的測試次數與重疊次數
+    std::vector<int> chunkContacts_;
+    std::vector<int> heroContacts_;          // 本步與英雄重疊的怪獸 ID（推開前）
+    const DistanceKernels* kernels_;         // 窄相位的批次距離核心
+    CollisionStats stats_;
+
+    void BuildCells(const MonsterPool& monsters);
+    void ResolveRange(int begin, int end, int& candidates, int& contacts);
+    int CountCandidates(int k) const;
+    void SelectBatch(int capacity);
+    void ResolveHero(MonsterPool& monsters, const Hero& hero);
+    int CellOf(float x, float y) const;
+
+public:
+    CollisionSystem(int worldWidth = GameConstants::MAP_WIDTH,
+                    int worldHeight = GameConstants::MAP_HEIGHT,
+                    int cellSize = GameConstants::MONSTER_SIZE);
+
+    // 預先配置 capacity 隻怪獸所需的暫存；之後每步不再配置記憶體
+    void Reserve(int capacity);
+    void Reset() { cursor_ = 0; }
+    void SetBudget(int testsPerTick) { budget_ = testsPerTick; }
+    int GetBudget() const { return budget_; }
+    void SetSimdLevel(SimdLevel level) { kernels_ = &GetDistanceKernels(level); }
+
+    // 分離重疊的怪獸，再把怪獸推出英雄範圍；提供 jobs 時窄相位平行計算
+    void Resolve(MonsterPool& monsters, const Hero& hero, JobSystem* jobs = nullptr);
+
+    const CollisionStats& GetStats() const { return stats_; }
+    const std::vector<int>& GetHeroContacts() const { return heroContacts_; }
+    const std::vector<int>& GetResolvedIds() const { return resolveIds_; }
+};
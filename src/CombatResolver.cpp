@@ -0,0 +1,166 @@
+#include "CombatResolver.h"
+#include "EventBus.h"
+#include "MonsterPool.h"
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace GameConstants;
+
+namespace {
+
+const float MONSTER_RADIUS = MONSTER_SIZE * 0.5f;
+
+Vector2D FacingVector(Direction facing) {
+    switch (facing) {
+        case Direction::Up:    return Vector2D(0, -1);
+        case Direction::Down:  return Vector2D(0, 1);
+        case Direction::Left:  return Vector2D(-1, 0);
+        default:               return Vector2D(1, 0);
+    }
+}
+
+bool NearerFirst(const CombatHit& a, const CombatHit& b) {
+    return a.distanceSq != b.distanceSq ? a.distanceSq < b.distanceSq : a.id < b.id;
+}
+
+}
+
+// ============================================================================
+// 判定範圍
+// ============================================================================
+HitArea HitArea::FromWeapon(const WeaponStats& weapon, Vector2D heroCenter, Direction facing) {
+    HitArea area;
+    area.shape = weapon.hitShape;
+    area.origin = Vector2D(heroCenter.x - MONSTER_RADIUS, heroCenter.y - MONSTER_RADIUS);
+    area.direction = FacingVector(facing);
+    area.reach = weapon.range + MONSTER_RADIUS;
+    area.cosHalfAngle = std::cos(std::min(weapon.arcDegrees, 360.0f) * 0.5f * 3.14159265f / 180.0f);
+    area.halfWidth = weapon.lineWidth * 0.5f + MONSTER_RADIUS;
+    return area;
+}
+
+float HitArea::GetBoundingRadius() const {
+    if (shape == HitShape::Line) return std::sqrt(reach * reach + halfWidth * halfWidth);
+    return reach;
+}
+
+void HitArea::GetBounds(float& left, float& top, float& right, float& bottom) const {
+    if (shape == HitShape::Line) {
+        // 從起點到終點的線段向兩側各擴張半寬
+        Vector2D end = origin + direction * reach;
+        left = std::min(origin.x, end.x) - halfWidth;
+        right = std::max(origin.x, end.x) + halfWidth;
+        top = std::min(origin.y, end.y) - halfWidth;
+        bottom = std::max(origin.y, end.y) + halfWidth;
+        return;
+    }
+    left = origin.x - reach;
+    top = origin.y - reach;
+    right = origin.x + reach;
+    bottom = origin.y + reach;
+}
+
+bool HitArea::Contains(Vector2D pos) const {
+    float dx = pos.x - origin.x;
+    float dy = pos.y - origin.y;
+    float along = dx * direction.x + dy * direction.y;
+    switch (shape) {
+        case HitShape::Line: {
+            float across = dx * direction.y - dy * direction.x;
+            return along >= 0 && along <= reach && std::fabs(across) <= halfWidth;
+        }
+        case HitShape::Arc: {
+            float distSq = dx * dx + dy * dy;
+            if (distSq > reach * reach) return false;
+            // 與英雄重疊的怪獸無論方向都算命中
+            return distSq <= MONSTER_RADIUS * MONSTER_RADIUS || along >= cosHalfAngle * std::sqrt(distSq);
+        }
+        default:
+            return dx * dx + dy * dy <= reach * reach;
+    }
+}
+
+// ============================================================================
+// 命中收集與套用
+// ============================================================================
+CombatResolver::CombatResolver()
+    : kernels_(&GetDistanceKernels(GetHostSimdLevel()))
+    , stats_()
+{
+}
+
+void CombatResolver::Reserve(int capacity) {
+    candidates_.reserve(capacity);
+    candidateX_.reserve(capacity);
+    candidateY_.reserve(capacity);
+    kernelHits_.reserve(capacity);
+    hits_.reserve(capacity);
+}
+
+int CombatResolver::Collect(const SpatialGrid& grid, const HitArea& area, int maxTargets) {
+    stats_ = CombatStats();
+    hits_.clear();
+    candidates_.clear();
+
+    float left, top, right, bottom;
+    area.GetBounds(left, top, right, bottom);
+    grid.QueryRect(left, top, right, bottom, candidates_);
+    const int count = (int)candidates_.size();
+    stats_.candidates = count;
+    if (count == 0) return 0;
+
+    candidateX_.resize(count);
+    candidateY_.resize(count);
+    kernelHits_.resize(count);
+    for (int i = 0; i < count; i++) {
+        Vector2D pos = grid.GetPosition(candidates_[i]);
+        candidateX_[i] = pos.x;
+        candidateY_[i] = pos.y;
+    }
+
+    // 外接圓篩選交給批次核心，形狀測試只做在剩下的候選上
+    float radius = area.GetBoundingRadius();
+    int inside = kernels_->radiusQuery(candidateX_.data(), candidateY_.data(), count,
+                                       area.origin.x, area.origin.y, radius * radius, kernelHits_.data());
+    for (int i = 0; i < inside; i++) {
+        int k = kernelHits_[i];
+        Vector2D pos(candidateX_[k], candidateY_[k]);
+        if (!area.Contains(pos)) continue;
+        hits_.push_back({ candidates_[k], pos.DistanceSquaredTo(area.origin) });
+    }
+
+    // 只需要最近的幾隻時部分排序即可
+    if (maxTargets > 0 && maxTargets < (int)hits_.size()) {
+        std::partial_sort(hits_.begin(), hits_.begin() + maxTargets, hits_.end(), NearerFirst);
+        hits_.resize(maxTargets);
+    } else {
+        std::sort(hits_.begin(), hits_.end(), NearerFirst);
+    }
+    stats_.targets = (int)hits_.size();
+    return stats_.targets;
+}
+
+const CombatStats& CombatResolver::Apply(MonsterPool& monsters, int damage, EventBus* events) {
+    for (const CombatHit& hit : hits_) {
+        int hp = monsters.GetCurrentHp(hit.id);
+        int level = monsters.GetLevel(hit.id);
+        Vector2D pos = monsters.GetPosition(hit.id);
+        monsters.TakeDamage(hit.id, damage);
+        // 只計實際扣掉的生命，超出剩餘生命的部分不算（HUD 的輸出總和由事件累加）
+        int applied = std::min(hp, damage);
+        stats_.damage += applied;
+        if (events) {
+            events->Publish(GameEvent::MakeDamageDealt(hit.id, applied, monsters.GetCurrentHp(hit.id), false, pos));
+        }
+        if (!monsters.IsAlive(hit.id)) {
+            int experience = MonsterPool::ExperienceForLevel(level);
+            stats_.kills++;
+            stats_.experience += experience;
+            if (events) {
+                events->Publish(GameEvent::MakeMonsterKilled(hit.id, level, experience, pos));
+            }
+        }
+    }
+    return stats_;
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include "DistanceKernels.h"
+#include "Types.h"
+#include <vector>
+
+class EventBus;
+class MonsterPool;
+class SpatialGrid;
+
+// ============================================================================
+// 攻擊判定範圍（由武器屬性與英雄面向推導）
+// 座標以怪獸左上角表示英雄中心，與怪獸座標相減即為兩者中心的差
+// ============================================================================
+struct HitArea {
+    HitShape shape;
+    Vector2D origin;             // 英雄中心（怪獸左上角座標系）
+    Vector2D direction;          // 面向的單位向量
+    float reach;                 // 判定距離加上怪獸半徑（量到怪獸邊緣）
+    float cosHalfAngle;          // 扇形半張角的餘弦
+    float halfWidth;             // 直線半寬加上怪獸半徑
+
+    static HitArea FromWeapon(const WeaponStats& weapon, Vector2D heroCenter, Direction facing);
+
+    // 外接圓半徑：寬相位以此半徑取候選
+    float GetBoundingRadius() const;
+    // 外接方框（網格查詢用）
+    void GetBounds(float& left, float& top, float& right, float& bottom) const;
+    // 怪獸座標 pos 是否落在範圍內
+    bool Contains(Vector2D pos) const;
+};
+
+// ============================================================================
+// 攻擊命中與統計（最近一次 Resolve）
+// ============================================================================
+struct CombatHit {
+    int id;                      // 怪獸 ID
+    float distanceSq;            // 與英雄中心的距離平方（排序鍵）
+};
+
+struct CombatStats {
+    int candidates;              // 網格取出的候選數
+    int targets;                 // 命中數（套用上限後）
+    int kills;
+    int experience;              // 擊殺獲得的經驗總和
+    int damage;                  // 實際造成的傷害總和（不超過怪獸剩餘生命）
+};
+
+// ============================================================================
+// 範圍攻擊判定
+// 1. 網格取出判定範圍外接方框內的怪獸，座標整理成連續陣列後以批次核心篩掉外接圓外的候選
+// 2. 剩下的逐一做形狀測試（扇形看角度、直線看投影），依距離由近到遠排序（同距離依 ID），取前 maxTargets 隻
+// 3. 對命中者依序扣血，經驗與擊殺數累計後由呼叫端一次交給英雄；傷害與擊殺另外發布成事件
+// 成本只與判定範圍附近的怪獸數有關，與場上總數無關；暫存預先配置，攻擊時不配置記憶體
+// ============================================================================
+class CombatResolver {
+private:
+    std::vector<int> candidates_;            // 網格查詢結果
+    std::vector<float> candidateX_;          // 候選座標（連續存放，交給批次距離核心）
+    std::vector<float> candidateY_;
+    std::vector<int> kernelHits_;            // 核心回傳的命中索引
+    std::vector<CombatHit> hits_;            // 形狀內的目標（排序後）
+    const DistanceKernels* kernels_;
+    CombatStats stats_;
+
+public:
+    CombatResolver();
+
+    // 預先配置 capacity 隻怪獸所需的暫存
+    void Reserve(int capacity);
+    void SetSimdLevel(SimdLevel level) { kernels_ = &GetDistanceKernels(level); }
+
+    // 收集範圍內的目標並依距離排序，回傳命中數（maxTargets 為 0 表示不限）
+    int Collect(const SpatialGrid& grid, const HitArea& area, int maxTargets);
+    // 對 Collect 收集到的目標造成傷害，回傳這次攻擊的統計；提供 events 時每次命中與擊殺各發布一筆
+    const CombatStats& Apply(MonsterPool& monsters, int damage, EventBus* events = nullptr);
+
+    const std::vector<CombatHit>& GetHits() const { return hits_; }
+    const CombatStats& GetStats() const { return stats_; }
+};
@@ -0,0 +1,583 @@
+#include "ContentDatabase.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace GameConstants;
+
+static_assert(sizeof(ContentDatabase::Header) == 48, "content cache header layout");
+static_assert(sizeof(ContentDatabase::WeaponRecord) == 56, "content cache weapon layout");
+static_assert(sizeof(ContentDatabase::MonsterRecord) == 16, "content cache monster layout");
+
+namespace {
+
+// 內建預設內容：與 data/content.txt 相同，修改其中一邊時請同步另一邊
+const char* const DEFAULT_CONTENT = R"(
+[weapon]
+name = 長劍
+description = 攻擊快速，橫掃前方
+shape = sword
+damage = 15
+interval = 500
+color = 192, 192, 192
+hit = arc
+range = 90
+angle = 120
+targets = 6
+
+[weapon]
+name = 戰斧
+description = 傷害強大，迴旋劈砍
+shape = axe
+damage = 30
+interval = 1000
+color = 139, 69, 19
+hit = circle
+range = 80
+targets = 0
+
+[weapon]
+name = 長槍
+description = 直線貫穿
+shape = sword
+damage = 20
+interval = 700
+color = 150, 170, 210
+hit = line
+range = 200
+width = 24
+targets = 0
+
+[monster]
+level = 1
+color = 100, 200, 100
+weight = 3200
+spacing = 1.0
+
+[monster]
+level = 2
+color = 50, 150, 50
+weight = 2000
+spacing = 1.0
+
+[monster]
+level = 3
+color = 200, 200, 50
+weight = 1200
+spacing = 1.0
+
+[monster]
+level = 4
+color = 255, 165, 0
+weight = 800
+spacing = 1.0
+
+[monster]
+level = 5
+color = 255, 100, 50
+weight = 400
+spacing = 1.0
+
+[monster]
+level = 6
+color = 200, 50, 50
+weight = 100
+spacing = 1.5
+
+[monster]
+level = 7
+color = 150, 0, 150
+weight = 100
+spacing = 1.5
+
+[monster]
+level = 8
+color = 100, 0, 100
+weight = 100
+spacing = 1.5
+
+[monster]
+level = 9
+color = 50, 50, 50
+weight = 100
+spacing = 1.5
+)";
+
+const int MONSTER_RECORDS = MAX_MONSTER_LEVEL + 1;
+
+// 去除前後空白
+void Trim(const char*& begin, const char*& end) {
+    while (begin < end && (*begin == ' ' || *begin == '\t' || *begin == '\r')) begin++;
+    while (end > begin && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r')) end--;
+}
+
+bool Equals(const char* begin, const char* end, const char* literal) {
+    size_t length = std::strlen(literal);
+    return (size_t)(end - begin) == length && std::memcmp(begin, literal, length) == 0;
+}
+
+bool ParseInt(const char* begin, const char* end, int& value) {
+    std::string text(begin, end);
+    char* stop = nullptr;
+    long parsed = std::strtol(text.c_str(), &stop, 10);
+    if (text.empty() || *stop != '\0') return false;
+    value = (int)parsed;
+    return true;
+}
+
+bool ParseFloat(const char* begin, const char* end, float& value) {
+    std::string text(begin, end);
+    char* stop = nullptr;
+    float parsed = std::strtof(text.c_str(), &stop);
+    if (text.empty() || *stop != '\0') return false;
+    value = parsed;
+    return true;
+}
+
+// "R, G, B"
+bool ParseColor(const char* begin, const char* end, Color& color) {
+    int channels[3];
+    for (int i = 0; i < 3; i++) {
+        const char* comma = i < 2 ? std::find(begin, end, ',') : end;
+        if (comma == end && i < 2) return false;
+
+        const char* fieldBegin = begin;
+        const char* fieldEnd = comma;
+        Trim(fieldBegin, fieldEnd);
+        if (!ParseInt(fieldBegin, fieldEnd, channels[i]) || channels[i] < 0 || channels[i] > 255) return false;
+        begin = comma + 1;
+    }
+    color = MakeColor(channels[0], channels[1], channels[2]);
+    return true;
+}
+
+// UTF-8 轉 UTF-16，附加到字串表並回傳起點
+uint32_t AppendString(std::vector<uint16_t>& table, const std::string& utf8) {
+    uint32_t offset = (uint32_t)table.size();
+    size_t i = 0;
+    while (i < utf8.size()) {
+        uint8_t lead = (uint8_t)utf8[i];
+        uint32_t codePoint;
+        int extra;
+        if (lead < 0x80) { codePoint = lead; extra = 0; }
+        else if ((lead >> 5) == 0x6) { codePoint = lead & 0x1F; extra = 1; }
+        else if ((lead >> 4) == 0xE) { codePoint = lead & 0x0F; extra = 2; }
+        else if ((lead >> 3) == 0x1E) { codePoint = lead & 0x07; extra = 3; }
+        else { codePoint = 0xFFFD; extra = 0; }
+        i++;
+
+        for (int k = 0; k < extra; k++, i++) {
+            if (i >= utf8.size() || ((uint8_t)utf8[i] >> 6) != 0x2) {
+                codePoint = 0xFFFD;
+                break;
+            }
+            codePoint = (codePoint << 6) | ((uint8_t)utf8[i] & 0x3F);
+        }
+
+        if (codePoint >= 0x10000) {
+            codePoint -= 0x10000;
+            table.push_back((uint16_t)(0xD800 + (codePoint >> 10)));
+            table.push_back((uint16_t)(0xDC00 + (codePoint & 0x3FF)));
+        } else {
+            table.push_back((uint16_t)codePoint);
+        }
+    }
+    return offset;
+}
+
+size_t Align4(size_t value) {
+    return (value + 3) & ~(size_t)3;
+}
+
+// 原始檔的大小與修改時間，用來判斷快取是否過期
+bool GetSourceStamp(const std::filesystem::path& path, uint64_t& size, int64_t& time) {
+    std::error_code error;
+    uintmax_t fileSize = std::filesystem::file_size(path, error);
+    if (error) return false;
+    auto writeTime = std::filesystem::last_write_time(path, error);
+    if (error) return false;
+
+    size = (uint64_t)fileSize;
+    time = (int64_t)writeTime.time_since_epoch().count();
+    return true;
+}
+
+}
+
+// ============================================================================
+// 建構與預設內容
+// ============================================================================
+ContentDatabase::ContentDatabase()
+    : data_(nullptr)
+    , size_(0)
+    , source_(Source::Builtin)
+    , loadMs_(0)
+{
+    Compile(DEFAULT_CONTENT, std::strlen(DEFAULT_CONTENT), 0, 0);
+    source_ = Source::Builtin;
+}
+
+const ContentDatabase& ContentDatabase::GetDefault() {
+    static const ContentDatabase defaults;
+    return defaults;
+}
+
+// ============================================================================
+// 載入
+// ============================================================================
+ContentDatabase::LoadResult ContentDatabase::Load(const std::filesystem::path& textPath,
+                                                  const std::filesystem::path& cachePath) {
+    auto start = std::chrono::steady_clock::now();
+
+    // 兩個檔案都不存在（例如從其他工作目錄啟動）不算錯誤，直接沿用目前內容
+    std::error_code error;
+    bool hasText = std::filesystem::exists(textPath, error);
+    bool hasCache = std::filesystem::exists(cachePath, error);
+    LoadResult result = LoadResult::NotFound;
+    if (hasText || hasCache) {
+        // 沒有原始檔時（只發佈快取）直接使用快取；原始檔有誤時沿用映射到的快取
+        bool loaded = MapCache(cachePath) && (!hasText || IsCacheFresh(textPath));
+        if (!loaded && hasText && LoadText(textPath)) {
+            SaveCache(cachePath);
+            loaded = true;
+        }
+        result = loaded ? LoadResult::Loaded : LoadResult::Failed;
+    } else {
+        error_ = "no content source found";
+    }
+
+    loadMs_ = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+bool ContentDatabase::IsCacheFresh(const std::filesystem::path& textPath) const {
+    if (source_ != Source::Cache) return false;
+
+    uint64_t size;
+    int64_t time;
+    if (!GetSourceStamp(textPath, size, time)) return false;
+    return GetHeader().sourceSize == size && GetHeader().sourceTime == time;
+}
+
+bool ContentDatabase::LoadText(const std::filesystem::path& textPath) {
+    uint64_t size;
+    int64_t time;
+    if (!GetSourceStamp(textPath, size, time)) {
+        error_ = "cannot read " + textPath.string();
+        return false;
+    }
+
+#ifdef _WIN32
+    FILE* file = _wfopen(textPath.c_str(), L"rb");
+#else
+    FILE* file = std::fopen(textPath.c_str(), "rb");
+#endif
+    if (!file) {
+        error_ = "cannot open " + textPath.string();
+        return false;
+    }
+
+    std::string text((size_t)size, '\0');
+    size_t read = std::fread(&text[0], 1, text.size(), file);
+    std::fclose(file);
+    text.resize(read);
+
+    if (!Compile(text.data(), text.size(), size, time)) return false;
+    source_ = Source::Text;
+    return true;
+}
+
+bool ContentDatabase::LoadFromString(const std::string& text) {
+    if (!Compile(text.data(), text.size(), text.size(), 0)) return false;
+    source_ = Source::Text;
+    return true;
+}
+
+bool ContentDatabase::SaveCache(const std::filesystem::path& cachePath) const {
+#ifdef _WIN32
+    FILE* file = _wfopen(cachePath.c_str(), L"wb");
+#else
+    FILE* file = std::fopen(cachePath.c_str(), "wb");
+#endif
+    if (!file) return false;
+
+    size_t written = std::fwrite(data_, 1, size_, file);
+    return std::fclose(file) == 0 && written == size_;
+}
+
+bool ContentDatabase::MapCache(const std::filesystem::path& cachePath) {
+    // 先映射到暫存物件，驗證通過後才取代目前內容
+    MappedFile mapping;
+    if (!mapping.Open(cachePath)) {
+        error_ = "cannot map " + cachePath.string();
+        return false;
+    }
+    if (!Validate(mapping.GetData(), mapping.GetSize())) {
+        error_ = "invalid cache " + cachePath.string();
+        return false;
+    }
+
+    mapping_.Swap(mapping);
+    std::vector<uint8_t>().swap(image_);
+    data_ = mapping_.GetData();
+    size_ = mapping_.GetSize();
+    source_ = Source::Cache;
+    return true;
+}
+
+bool ContentDatabase::Validate(const uint8_t* data, size_t size) {
+    if (size < sizeof(Header)) return false;
+
+    const Header& header = *(const Header*)data;
+    if (header.magic != MAGIC || header.version != VERSION || header.totalBytes != size) return false;
+
+    // 各區段都必須落在影像範圍內，之後的查詢不再檢查
+    uint64_t weaponEnd = (uint64_t)header.weaponOffset + (uint64_t)header.weaponCount * sizeof(WeaponRecord);
+    uint64_t monsterEnd = (uint64_t)header.monsterOffset + MONSTER_RECORDS * sizeof(MonsterRecord);
+    uint64_t stringEnd = (uint64_t)header.stringOffset + (uint64_t)header.stringCount * sizeof(uint16_t);
+    if (weaponEnd > size || monsterEnd > size || stringEnd > size) return false;
+    if ((header.weaponOffset | header.monsterOffset | header.stringOffset) & 3) return false;
+
+    const WeaponRecord* weapons = (const WeaponRecord*)(data + header.weaponOffset);
+    for (uint32_t i = 0; i < header.weaponCount; i++) {
+        const WeaponRecord& weapon = weapons[i];
+        if (weapon.shape != (int32_t)WeaponType::Sword && weapon.shape != (int32_t)WeaponType::Axe) return false;
+        if (weapon.hitShape < (int32_t)HitShape::Circle || weapon.hitShape > (int32_t)HitShape::Line) return false;
+        if ((uint64_t)weapon.nameOffset + weapon.nameLength > header.stringCount) return false;
+        if ((uint64_t)weapon.descriptionOffset + weapon.descriptionLength > header.stringCount) return false;
+        // 數值範圍與 Compile 相同；浮點數以否定式比較，NaN 也會被擋下
+        if (weapon.attackSpeed <= 0 || weapon.maxTargets < 0) return false;
+        if (!(weapon.range > 0) || !(weapon.arcDegrees > 0 && weapon.arcDegrees <= 360) || !(weapon.lineWidth >= 0)) return false;
+    }
+
+    const MonsterRecord* monsters = (const MonsterRecord*)(data + header.monsterOffset);
+    for (int i = 0; i < MONSTER_RECORDS; i++) {
+        if (monsters[i].spawnWeight < 0 || !(monsters[i].spawnSpacing > 0)) return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// 文字原始檔編譯
+// 格式：[weapon] / [monster] 區段，區段內為 key = value；# 或 ; 開頭為註解
+// ============================================================================
+bool ContentDatabase::Compile(const char* text, size_t length, uint64_t sourceSize, int64_t sourceTime) {
+    enum class Section { None, Weapon, Monster };
+
+    std::vector<WeaponRecord> weapons;
+    std::vector<std::string> weaponNames;
+    std::vector<std::string> weaponDescriptions;
+    MonsterRecord monsters[MONSTER_RECORDS];
+    for (MonsterRecord& monster : monsters) {
+        monster = { MakeColor(0, 0, 0), 0, 1.0f, 0 };
+    }
+
+    Section section = Section::None;
+    int monsterLevel = 0;
+    MonsterRecord pendingMonster = {};
+    int lineNumber = 0;
+    char message[160];
+
+    auto fail = [&](const char* reason) {
+        std::snprintf(message, sizeof(message), "line %d: %s", lineNumber, reason);
+        error_ = message;
+        return false;
+    };
+    auto finishMonster = [&]() {
+        if (section != Section::Monster) return true;
+        if (monsterLevel < 1 || monsterLevel > MAX_MONSTER_LEVEL) return fail("monster level must be 1-9");
+        monsters[monsterLevel] = pendingMonster;
+        return true;
+    };
+    auto finishWeapon = [&]() {
+        if (section != Section::Weapon) return true;
+        if (weaponNames.back().empty()) return fail("weapon needs a name");
+        if (weapons.back().shape == (int32_t)WeaponType::None) return fail("weapon needs a shape");
+        return true;
+    };
+
+    const char* cursor = text;
+    const char* end = text + length;
+    // 略過 UTF-8 BOM
+    if (length >= 3 && std::memcmp(text, "\xEF\xBB\xBF", 3) == 0) cursor += 3;
+
+    while (cursor < end) {
+        const char* lineEnd = std::find(cursor, end, '\n');
+        const char* lineBegin = cursor;
+        cursor = lineEnd < end ? lineEnd + 1 : end;
+        lineNumber++;
+
+        Trim(lineBegin, lineEnd);
+        if (lineBegin == lineEnd || *lineBegin == '#' || *lineBegin == ';') continue;
+
+        if (*lineBegin == '[') {
+            if (!finishWeapon() || !finishMonster()) return false;
+
+            if (Equals(lineBegin, lineEnd, "[weapon]")) {
+                section = Section::Weapon;
+                weapons.push_back({ 0, 0, 0, 0, (int32_t)WeaponType::None, 0, 500, MakeColor(128, 128, 128),
+                                   (int32_t)HitShape::Circle, (float)ATTACK_RANGE, 360.0f, 0, 1, 0 });
+                weaponNames.emplace_back();
+                weaponDescriptions.emplace_back();
+            } else if (Equals(lineBegin, lineEnd, "[monster]")) {
+                section = Section::Monster;
+                monsterLevel = 0;
+                pendingMonster = { MakeColor(0, 0, 0), 0, 1.0f, 0 };
+            } else {
+                return fail("unknown section");
+            }
+            continue;
+        }
+
+        const char* equals = std::find(lineBegin, lineEnd, '=');
+        if (equals == lineEnd) return fail("expected key = value");
+        const char* keyBegin = lineBegin;
+        const char* keyEnd = equals;
+        const char* valueBegin = equals + 1;
+        const char* valueEnd = lineEnd;
+        Trim(keyBegin, keyEnd);
+        Trim(valueBegin, valueEnd);
+
+        bool ok = true;
+        if (section == Section::Weapon) {
+            WeaponRecord& weapon = weapons.back();
+            if (Equals(keyBegin, keyEnd, "name")) {
+                weaponNames.back().assign(valueBegin, valueEnd);
+            } else if (Equals(keyBegin, keyEnd, "description")) {
+                weaponDescriptions.back().assign(valueBegin, valueEnd);
+            } else if (Equals(keyBegin, keyEnd, "shape")) {
+                if (Equals(valueBegin, valueEnd, "sword")) weapon.shape = (int32_t)WeaponType::Sword;
+                else if (Equals(valueBegin, valueEnd, "axe")) weapon.shape = (int32_t)WeaponType::Axe;
+                else return fail("shape must be sword or axe");
+            } else if (Equals(keyBegin, keyEnd, "damage")) {
+                ok = ParseInt(valueBegin, valueEnd, weapon.damage);
+            } else if (Equals(keyBegin, keyEnd, "interval")) {
+                ok = ParseInt(valueBegin, valueEnd, weapon.attackSpeed) && weapon.attackSpeed > 0;
+            } else if (Equals(keyBegin, keyEnd, "color")) {
+                ok = ParseColor(valueBegin, valueEnd, weapon.color);
+            } else if (Equals(keyBegin, keyEnd, "hit")) {
+                if (Equals(valueBegin, valueEnd, "circle")) weapon.hitShape = (int32_t)HitShape::Circle;
+                else if (Equals(valueBegin, valueEnd, "arc")) weapon.hitShape = (int32_t)HitShape::Arc;
+                else if (Equals(valueBegin, valueEnd, "line")) weapon.hitShape = (int32_t)HitShape::Line;
+                else return fail("hit must be circle, arc or line");
+            } else if (Equals(keyBegin, keyEnd, "range")) {
+                ok = ParseFloat(valueBegin, valueEnd, weapon.range) && weapon.range > 0;
+            } else if (Equals(keyBegin, keyEnd, "angle")) {
+                ok = ParseFloat(valueBegin, valueEnd, weapon.arcDegrees) && weapon.arcDegrees > 0 && weapon.arcDegrees <= 360;
+            } else if (Equals(keyBegin, keyEnd, "width")) {
+                ok = ParseFloat(valueBegin, valueEnd, weapon.lineWidth) && weapon.lineWidth >= 0;
+            } else if (Equals(keyBegin, keyEnd, "targets")) {
+                ok = ParseInt(valueBegin, valueEnd, weapon.maxTargets) && weapon.maxTargets >= 0;
+            } else {
+                return fail("unknown weapon key");
+            }
+        } else if (section == Section::Monster) {
+            if (Equals(keyBegin, keyEnd, "level")) {
+                ok = ParseInt(valueBegin, valueEnd, monsterLevel);
+            } else if (Equals(keyBegin, keyEnd, "color")) {
+                ok = ParseColor(valueBegin, valueEnd, pendingMonster.color);
+            } else if (Equals(keyBegin, keyEnd, "weight")) {
+                ok = ParseInt(valueBegin, valueEnd, pendingMonster.spawnWeight) && pendingMonster.spawnWeight >= 0;
+            } else if (Equals(keyBegin, keyEnd, "spacing")) {
+                ok = ParseFloat(valueBegin, valueEnd, pendingMonster.spawnSpacing) && pendingMonster.spawnSpacing > 0;
+            } else {
+                return fail("unknown monster key");
+            }
+        } else {
+            return fail("key outside of a section");
+        }
+        if (!ok) return fail("invalid value");
+    }
+    if (!finishWeapon() || !finishMonster()) return false;
+    if (weapons.empty()) return fail("no weapons defined");
+
+    // 字串表（UTF-16）
+    std::vector<uint16_t> strings;
+    for (size_t i = 0; i < weapons.size(); i++) {
+        weapons[i].nameOffset = AppendString(strings, weaponNames[i]);
+        weapons[i].nameLength = (uint32_t)strings.size() - weapons[i].nameOffset;
+        weapons[i].descriptionOffset = AppendString(strings, weaponDescriptions[i]);
+        weapons[i].descriptionLength = (uint32_t)strings.size() - weapons[i].descriptionOffset;
+    }
+
+    // 組合影像
+    Header header = {};
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.sourceSize = sourceSize;
+    header.sourceTime = sourceTime;
+    header.weaponCount = (uint32_t)weapons.size();
+    header.weaponOffset = (uint32_t)Align4(sizeof(Header));
+    header.monsterOffset = (uint32_t)Align4(header.weaponOffset + weapons.size() * sizeof(WeaponRecord));
+    header.stringOffset = (uint32_t)Align4(header.monsterOffset + sizeof(monsters));
+    header.stringCount = (uint32_t)strings.size();
+    header.totalBytes = (uint32_t)Align4(header.stringOffset + strings.size() * sizeof(uint16_t));
+
+    std::vector<uint8_t> image(header.totalBytes, 0);
+    std::memcpy(image.data(), &header, sizeof(header));
+    std::memcpy(image.data() + header.weaponOffset, weapons.data(), weapons.size() * sizeof(WeaponRecord));
+    std::memcpy(image.data() + header.monsterOffset, monsters, sizeof(monsters));
+    if (!strings.empty()) {
+        std::memcpy(image.data() + header.stringOffset, strings.data(), strings.size() * sizeof(uint16_t));
+    }
+
+    mapping_.Close();
+    image_.swap(image);
+    data_ = image_.data();
+    size_ = image_.size();
+    error_.clear();
+    return true;
+}
+
+// ============================================================================
+// 查詢（直接讀取影像，不需解析）
+// ============================================================================
+const ContentDatabase::WeaponRecord& ContentDatabase::GetWeaponRecord(int index) const {
+    const WeaponRecord* weapons = (const WeaponRecord*)(data_ + GetHeader().weaponOffset);
+    return weapons[index];
+}
+
+const ContentDatabase::MonsterRecord& ContentDatabase::GetMonsterRecord(int level) const {
+    const MonsterRecord* monsters = (const MonsterRecord*)(data_ + GetHeader().monsterOffset);
+    return monsters[(level >= 1 && level <= MAX_MONSTER_LEVEL) ? level : 0];
+}
+
+std::wstring ContentDatabase::GetString(uint32_t offset, uint32_t length) const {
+    const uint16_t* strings = (const uint16_t*)(data_ + GetHeader().stringOffset);
+    return std::wstring(strings + offset, strings + offset + length);
+}
+
+uint64_t ContentDatabase::GetContentHash() const {
+    // FNV-1a；區段位置由武器數與字串數決定，一併納入
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    auto mix = [&hash](uint64_t value) {
+        hash ^= value;
+        hash *= 0x100000001B3ULL;
+    };
+    mix(GetHeader().weaponCount);
+    mix(GetHeader().stringCount);
+    for (size_t i = sizeof(Header); i < size_; i++) mix(data_[i]);
+    return hash;
+}
+
+WeaponStats ContentDatabase::GetWeapon(int index) const {
+    WeaponStats stats;
+    if (index < 0 || index >= GetWeaponCount()) return stats;
+
+    const WeaponRecord& record = GetWeaponRecord(index);
+    stats.index = index;
+    stats.type = (WeaponType)record.shape;
+    stats.name = GetString(record.nameOffset, record.nameLength);
+    stats.description = GetString(record.descriptionOffset, record.descriptionLength);
+    stats.damage = record.damage;
+    stats.attackSpeed = record.attackSpeed;
+    stats.color = record.color;
+    stats.hitShape = (HitShape)record.hitShape;
+    stats.range = record.range;
+    stats.arcDegrees = record.arcDegrees;
+    stats.lineWidth = record.lineWidth;
+    stats.maxTargets = record.maxTargets;
+    return stats;
+}
@@ -0,0 +1,128 @@
+#pragma once
+#include "MappedFile.h"
+#include "Types.h"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+// ============================================================================
+// 遊戲內容資料（武器、怪獸等級外觀與生成等級表）
+//
+// 來源依序為：
+//   1. 編譯快取：與原始檔大小、修改時間相符時直接映射，不做任何解析
+//   2. 文字原始檔：解析後編譯成與快取相同的二進位影像，並寫出新的快取
+//   3. 內建預設值：找不到任何檔案時使用（內容與 data/content.txt 相同）
+// 無論來源為何，查詢都直接讀取同一種二進位影像
+//
+// 快取格式（小端序，所有區段 4 位元組對齊）：
+//   Header | WeaponRecord[weaponCount] | MonsterRecord[MAX_MONSTER_LEVEL + 1] | UTF-16 字串表
+// ============================================================================
+class ContentDatabase {
+public:
+    enum class Source {
+        Builtin,
+        Text,
+        Cache
+    };
+
+    enum class LoadResult {
+        Loaded,
+        NotFound,                    // 原始檔與快取都不存在（沿用目前內容，屬正常情況）
+        Failed                       // 有檔案但讀取、解析或驗證失敗（原因見 GetError）
+    };
+
+    static constexpr uint32_t MAGIC = 0x54435748;    // "HWCT"
+    static constexpr uint32_t VERSION = 2;
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t sourceSize;         // 原始檔大小（位元組）
+        int64_t sourceTime;          // 原始檔修改時間
+        uint32_t totalBytes;         // 整個影像的大小
+        uint32_t weaponCount;
+        uint32_t weaponOffset;
+        uint32_t monsterOffset;
+        uint32_t stringOffset;
+        uint32_t stringCount;        // 字串表的 UTF-16 字元數
+    };
+
+    struct WeaponRecord {
+        uint32_t nameOffset;         // 字串表中的起點（UTF-16 字元）
+        uint32_t nameLength;
+        uint32_t descriptionOffset;
+        uint32_t descriptionLength;
+        int32_t shape;               // WeaponType
+        int32_t damage;
+        int32_t attackSpeed;
+        uint32_t color;
+        int32_t hitShape;            // HitShape
+        float range;
+        float arcDegrees;
+        float lineWidth;
+        int32_t maxTargets;
+        uint32_t reserved;
+    };
+
+    struct MonsterRecord {
+        uint32_t color;
+        int32_t spawnWeight;         // 生成權重（0 表示不生成）
+        float spawnSpacing;          // 生成間距倍率
+        uint32_t reserved;
+    };
+
+private:
+    std::vector<uint8_t> image_;     // 由文字編譯出的影像（映射快取時為空）
+    MappedFile mapping_;             // 映射的快取檔
+    const uint8_t* data_;            // 目前使用的影像
+    size_t size_;
+    Source source_;
+    double loadMs_;                  // 最近一次載入耗時（毫秒）
+    std::string error_;              // 最近一次失敗的原因
+
+    bool Compile(const char* text, size_t length, uint64_t sourceSize, int64_t sourceTime);
+    static bool Validate(const uint8_t* data, size_t size);
+    const Header& GetHeader() const { return *(const Header*)data_; }
+    const WeaponRecord& GetWeaponRecord(int index) const;
+    const MonsterRecord& GetMonsterRecord(int level) const;
+    std::wstring GetString(uint32_t offset, uint32_t length) const;
+
+public:
+    ContentDatabase();
+    ContentDatabase(const ContentDatabase&) = delete;
+    ContentDatabase& operator=(const ContentDatabase&) = delete;
+
+    // 內建預設內容（不讀取任何檔案，模擬核心與基準測試的預設值）
+    static const ContentDatabase& GetDefault();
+
+    // 載入：快取有效時映射快取，否則解析原始檔並重寫快取；未載入時保留目前內容
+    LoadResult Load(const std::filesystem::path& textPath, const std::filesystem::path& cachePath);
+
+    // 個別步驟（供基準測試分開量測）
+    bool LoadText(const std::filesystem::path& textPath);
+    bool LoadFromString(const std::string& text);
+    bool SaveCache(const std::filesystem::path& cachePath) const;
+    bool MapCache(const std::filesystem::path& cachePath);
+    bool IsCacheFresh(const std::filesystem::path& textPath) const;
+
+    // 武器（依內容檔順序，對應選單按鍵 1~9）
+    int GetWeaponCount() const { return (int)GetHeader().weaponCount; }
+    WeaponStats GetWeapon(int index) const;
+
+    // 怪獸等級
+    Color GetMonsterColor(int level) const { return GetMonsterRecord(level).color; }
+    int GetSpawnWeight(int level) const { return GetMonsterRecord(level).spawnWeight; }
+    float GetSpawnSpacing(int level) const { return GetMonsterRecord(level).spawnSpacing; }
+
+    // 內容雜湊：只涵蓋武器、怪獸與字串表，不含原始檔大小與時間；
+    // 內容相同時無論來源（內建、文字或快取）都得到相同的值
+    uint64_t GetContentHash() const;
+
+    // 存取方法
+    Source GetSource() const { return source_; }
+    double GetLoadMs() const { return loadMs_; }
+    size_t GetImageSize() const { return size_; }
+    const std::string& GetError() const { return error_; }
+};
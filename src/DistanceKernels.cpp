@@ -0,0 +1,199 @@
+#include "DistanceKernels.h"
+#include <cstring>
+
+#ifdef HEROWAR_X86
+#include <immintrin.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace {
+
+// 最低位的 1 所在位置（bits 不為 0）
+inline int LowestBit(uint32_t bits) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, bits);
+    return (int)index;
+#else
+    return __builtin_ctz(bits);
+#endif
+}
+
+// 把一段命中位元展開成索引
+inline int AppendHits(uint32_t bits, int base, int* out, int hits) {
+    while (bits) {
+        out[hits++] = base + LowestBit(bits);
+        bits &= bits - 1;
+    }
+    return hits;
+}
+
+// ============================================================================
+// 純量版本
+// ============================================================================
+void DistanceSqScalar(const float* xs, const float* ys, int count, float cx, float cy, float* out) {
+    for (int i = 0; i < count; i++) {
+        float dx = xs[i] - cx;
+        float dy = ys[i] - cy;
+        out[i] = dx * dx + dy * dy;
+    }
+}
+
+void RadiusMaskScalar(const float* xs, const float* ys, int count, float cx, float cy, float radiusSq, uint64_t* mask) {
+    std::memset(mask, 0, (size_t)((count + 63) / 64) * sizeof(uint64_t));
+    for (int i = 0; i < count; i++) {
+        float dx = xs[i] - cx;
+        float dy = ys[i] - cy;
+        if (dx * dx + dy * dy <= radiusSq) {
+            mask[i >> 6] |= 1ull << (i & 63);
+        }
+    }
+}
+
+int RadiusQueryScalar(const float* xs, const float* ys, int count, float cx, float cy, float radiusSq, int* out) {
+    int hits = 0;
+    for (int i = 0; i < count; i++) {
+        float dx = xs[i] - cx;
+        float dy = ys[i] - cy;
+        if (dx * dx + dy * dy <= radiusSq) {
+            out[hits++] = i;
+        }
+    }
+    return hits;
+}
+
+#ifdef HEROWAR_X86
+
+// ============================================================================
+// SSE2 版本（一次 4 點）
+// ============================================================================
+inline __m128 DistanceSq4(const float* xs, const float* ys, __m128 cx, __m128 cy) {
+    __m128 dx = _mm_sub_ps(_mm_loadu_ps(xs), cx);
+    __m128 dy = _mm_sub_ps(_mm_loadu_ps(ys), cy);
+    return _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+}
+
+void DistanceSqSSE2(const float* xs, const float* ys, int count, float cx, float cy, float* out) {
+    __m128 centerX = _mm_set1_ps(cx);
+    __m128 centerY = _mm_set1_ps(cy);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(out + i, DistanceSq4(xs + i, ys + i, centerX, centerY));
+    }
+    DistanceSqScalar(xs + i, ys + i, count - i, cx, cy, out + i);
+}
+
+void RadiusMaskSSE2(const float* xs, const float* ys, int count, float cx, float cy, float radiusSq, uint64_t* mask) {
+    __m128 centerX = _mm_set1_ps(cx);
+    __m128 centerY = _mm_set1_ps(cy);
+    __m128 limit = _mm_set1_ps(radiusSq);
+    int i = 0;
+    // 每 64 點組成一個遮罩字
+    for (; i + 64 <= count; i += 64) {
+        uint64_t word = 0;
+        for (int k = 0; k < 64; k += 4) {
+            __m128 inside = _mm_cmple_ps(DistanceSq4(xs + i + k, ys + i + k, centerX, centerY), limit);
+            word |= (uint64_t)_mm_movemask_ps(inside) << k;
+        }
+        mask[i >> 6] = word;
+    }
+    if (i < count) {
+        RadiusMaskScalar(xs + i, ys + i, count - i, cx, cy, radiusSq, mask + (i >> 6));
+    }
+}
+
+int RadiusQuerySSE2(const float* xs, const float* ys, int count, float cx, float cy, float radiusSq, int* out) {
+    __m128 centerX = _mm_set1_ps(cx);
+    __m128 centerY = _mm_set1_ps(cy);
+    __m128 limit = _mm_set1_ps(radiusSq);
+    int hits = 0;
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        uint32_t bits = (uint32_t)_mm_movemask_ps(_mm_cmple_ps(DistanceSq4(xs + i, ys + i, centerX, centerY), limit));
+        hits = AppendHits(bits, i, out, hits);
+    }
+    int tail = RadiusQueryScalar(xs + i, ys + i, count - i, cx, cy, radiusSq, out + hits);
+    for (int k = 0; k < tail; k++) {
+        out[hits + k] += i;
+    }
+    return hits + tail;
+}
+
+// ============================================================================
+// AVX2 版本（一次 8 點）
+// ============================================================================
+HEROWAR_TARGET_AVX2
+inline __m256 DistanceSq8(const float* xs, const float* ys, __m256 cx, __m256 cy) {
+    __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(xs), cx);
+    __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(ys), cy);
+    return _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+}
+
+HEROWAR_TARGET_AVX2
+void DistanceSqAVX2(const float* xs, const float* ys, int count, float cx, float cy, float* out) {
+    __m256 centerX = _mm256_set1_ps(cx);
+    __m256 centerY = _mm256_set1_ps(cy);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_ps(out + i, DistanceSq8(xs + i, ys + i, centerX, centerY));
+    }
+    DistanceSqScalar(xs + i, ys + i, count - i, cx, cy, out + i);
+}
+
+HEROWAR_TARGET_AVX2
+void RadiusMaskAVX2(const float* xs, const float* ys, int count, float cx, float cy, float radiusSq, uint64_t* mask) {
+    __m256 centerX = _mm256_set1_ps(cx);
+    __m256 centerY = _mm256_set1_ps(cy);
+    __m256 limit = _mm256_set1_ps(radiusSq);
+    int i = 0;
+    for (; i + 64 <= count; i += 64) {
+        uint64_t word = 0;
+        for (int k = 0; k < 64; k += 8) {
+            __m256 inside = _mm256_cmp_ps(DistanceSq8(xs + i + k, ys + i + k, centerX, centerY), limit, _CMP_LE_OQ);
+            word |= (uint64_t)_mm256_movemask_ps(inside) << k;
+        }
+        mask[i >> 6] = word;
+    }
+    if (i < count) {
+        RadiusMaskScalar(xs + i, ys + i, count - i, cx, cy, radiusSq, mask + (i >> 6));
+    }
+}
+
+HEROWAR_TARGET_AVX2
+int RadiusQueryAVX2(const float* xs, const float* ys, int count, float cx, float cy, float radiusSq, int* out) {
+    __m256 centerX = _mm256_set1_ps(cx);
+    __m256 centerY = _mm256_set1_ps(cy);
+    __m256 limit = _mm256_set1_ps(radiusSq);
+    int hits = 0;
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 inside = _mm256_cmp_ps(DistanceSq8(xs + i, ys + i, centerX, centerY), limit, _CMP_LE_OQ);
+        hits = AppendHits((uint32_t)_mm256_movemask_ps(inside), i, out, hits);
+    }
+    int tail = RadiusQueryScalar(xs + i, ys + i, count - i, cx, cy, radiusSq, out + hits);
+    for (int k = 0; k < tail; k++) {
+        out[hits + k] += i;
+    }
+    return hits + tail;
+}
+
+#endif
+
+const DistanceKernels KERNELS[(int)SimdLevel::Count] = {
+    { DistanceSqScalar, RadiusMaskScalar, RadiusQueryScalar },
+#ifdef HEROWAR_X86
+    { DistanceSqSSE2, RadiusMaskSSE2, RadiusQuerySSE2 },
+    { DistanceSqAVX2, RadiusMaskAVX2, RadiusQueryAVX2 },
+#else
+    { DistanceSqScalar, RadiusMaskScalar, RadiusQueryScalar },
+    { DistanceSqScalar, RadiusMaskScalar, RadiusQueryScalar },
+#endif
+};
+
+}
+
+const DistanceKernels& GetDistanceKernels(SimdLevel level) {
+    return KERNELS[(int)ClampSimdLevel(level)];
+}
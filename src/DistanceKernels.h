@@ -0,0 +1,20 @@
+#pragma once
+#include "Simd.h"
+#include <cstdint>
+
+// ============================================================================
+// 批次距離核心
+// 對連續存放的座標陣列（SoA）一次計算多個點到中心的距離平方，全程不開根號；
+// 半徑判斷一律比較距離平方（<= radius²），與 SpatialGrid::QueryRadius 相同
+// 各有純量 / SSE2 / AVX2 版本，結果逐位元相同
+// ============================================================================
+struct DistanceKernels {
+    // out[i] = (xs[i] - cx)² + (ys[i] - cy)²
+    void (*distanceSq)(const float* xs, const float* ys, int count, float cx, float cy, float* out);
+    // 半徑內的點：第 i 點命中時設定 mask[i / 64] 的第 i % 64 位元（mask 需有 (count + 63) / 64 個元素）
+    void (*radiusMask)(const float* xs, const float* ys, int count, float cx, float cy, float radiusSq, uint64_t* mask);
+    // 半徑內的點：依序寫入索引到 out（需有 count 個空間），回傳命中數
+    int (*radiusQuery)(const float* xs, const float* ys, int count, float cx, float cy, float radiusSq, int* out);
+};
+
+const DistanceKernels& GetDistanceKernels(SimdLevel level);
@@ -0,0 +1,311 @@
+#include "EntityRenderer.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+using namespace GameConstants;
+
+// ============================================================================
+// 精靈圖集
+// ============================================================================
+int EntityRenderer::MonsterCell(int level) {
+    return (level >= 1 && level < MONSTER_VARIANTS) ? level : 0;
+}
+
+int EntityRenderer::HeroCell(Direction facing, int weaponIndex) {
+    return MONSTER_VARIANTS + (weaponIndex + 1) * FACING_VARIANTS + (int)facing;
+}
+
+void EntityRenderer::BuildSprites() {
+    auto start = std::chrono::steady_clock::now();
+    
+    int weaponVariants = std::min(WEAPON_VARIANTS, content_->GetWeaponCount() + 1);
+    HDC atlasDC = atlas_.Begin(MONSTER_VARIANTS + FACING_VARIANTS * weaponVariants);
+    
+    for (int level = 0; level < MONSTER_VARIANTS; level++) {
+        POINT anchor = atlas_.GetAnchor(MonsterCell(level));
+        DrawMonsterShape(atlasDC, level, anchor.x, anchor.y);
+    }
+    
+    for (int index = -1; index < weaponVariants - 1; index++) {
+        WeaponStats weapon = index >= 0 ? content_->GetWeapon(index) : WeaponStats();
+        for (int facing = 0; facing < FACING_VARIANTS; facing++) {
+            POINT anchor = atlas_.GetAnchor(HeroCell((Direction)facing, index));
+            DrawHeroShape(atlasDC, (Direction)facing, weapon, anchor.x, anchor.y);
+        }
+    }
+    
+    atlas_.End();
+    
+    spriteBuildMs_ = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+// ============================================================================
+// 英雄
+// ============================================================================
+void EntityRenderer::DrawHero(HDC hdc, const Hero& hero, Vector2D cameraOffset) {
+    if (!hero.IsAlive()) return;
+    
+    Vector2D position = hero.GetInterpolatedPosition(alpha_);
+    int screenX = (int)(position.x - cameraOffset.x);
+    int screenY = (int)(position.y - cameraOffset.y);
+    
+    if (IsUsingSprites() && hero.GetWeapon().index < WEAPON_VARIANTS - 1) {
+        atlas_.Draw(hdc, HeroCell(hero.GetFacing(), hero.GetWeapon().index), screenX, screenY);
+    } else {
+        DrawHeroShape(hdc, hero.GetFacing(), hero.GetWeapon(), screenX, screenY);
+    }
+}
+
+void EntityRenderer::DrawHeroShape(HDC hdc, Direction facing, const WeaponStats& weapon, int screenX, int screenY) {
+    int size = HERO_SIZE;
+    
+    HBRUSH bodyBrush = cache_->GetBrush(RGB(0, 100, 200));
+    HBRUSH oldBrush = (HBRUSH)SelectObject(hdc, bodyBrush);
+    Ellipse(hdc, screenX - size/2, screenY - size/2, 
+            screenX + size/2, screenY + size/2);
+    
+    HBRUSH headBrush = cache_->GetBrush(RGB(255, 220, 180));
+    SelectObject(hdc, headBrush);
+    int headSize = size / 3;
+    Ellipse(hdc, screenX - headSize, screenY - size/2 - headSize*2,
+            screenX + headSize, screenY - size/2);
+    
+    HBRUSH eyeBrush = cache_->GetBrush(RGB(0, 0, 0));
+    SelectObject(hdc, eyeBrush);
+    int eyeSize = 3;
+    int eyeOffset = headSize / 2;
+    int eyeX = screenX;
+    if (facing == Direction::Left) eyeX -= eyeOffset/2;
+    else if (facing == Direction::Right) eyeX += eyeOffset/2;
+    
+    Ellipse(hdc, eyeX - eyeOffset - eyeSize, screenY - size/2 - headSize - eyeSize,
+            eyeX - eyeOffset + eyeSize, screenY - size/2 - headSize + eyeSize);
+    Ellipse(hdc, eyeX + eyeOffset - eyeSize, screenY - size/2 - headSize - eyeSize,
+            eyeX + eyeOffset + eyeSize, screenY - size/2 - headSize + eyeSize);
+    
+    DrawWeapon(hdc, facing, weapon, Vector2D((float)screenX, (float)screenY));
+    
+    SelectObject(hdc, oldBrush);
+}
+
+void EntityRenderer::DrawWeapon(HDC hdc, Direction facing, const WeaponStats& weapon, Vector2D screenPos) {
+    if (weapon.type == WeaponType::None) return;
+    
+    HPEN weaponPen = cache_->GetPen(PS_SOLID, 3, weapon.color);
+    HPEN oldPen = (HPEN)SelectObject(hdc, weaponPen);
+    
+    int weaponLength = 25;
+    int startX = (int)screenPos.x;
+    int startY = (int)screenPos.y;
+    int endX = startX;
+    int endY = startY;
+    
+    switch (facing) {
+        case Direction::Up:
+            endY = startY - weaponLength;
+            break;
+        case Direction::Down:
+            endY = startY + weaponLength;
+            break;
+        case Direction::Left:
+            endX = startX - weaponLength;
+            break;
+        case Direction::Right:
+        default:
+            endX = startX + weaponLength;
+            break;
+    }
+    
+    MoveToEx(hdc, startX, startY, NULL);
+    LineTo(hdc, endX, endY);
+    
+    if (weapon.type == WeaponType::Axe) {
+        HBRUSH axeBrush = cache_->GetBrush(RGB(100, 100, 100));
+        HBRUSH oldBrush = (HBRUSH)SelectObject(hdc, axeBrush);
+        
+        POINT axeHead[4];
+        int axeSize = 10;
+        
+        if (facing == Direction::Right || facing == Direction::Left) {
+            axeHead[0] = { endX, endY - axeSize };
+            axeHead[1] = { endX + (facing == Direction::Right ? axeSize : -axeSize), endY };
+            axeHead[2] = { endX, endY + axeSize };
+            axeHead[3] = { endX, endY - axeSize };
+        } else {
+            axeHead[0] = { endX - axeSize, endY };
+            axeHead[1] = { endX, endY + (facing == Direction::Down ? axeSize : -axeSize) };
+            axeHead[2] = { endX + axeSize, endY };
+            axeHead[3] = { endX - axeSize, endY };
+        }
+        Polygon(hdc, axeHead, 4);
+        
+        SelectObject(hdc, oldBrush);
+    }
+    
+    if (weapon.type == WeaponType::Sword) {
+        HPEN hiltPen = cache_->GetPen(PS_SOLID, 2, RGB(139, 69, 19));
+        SelectObject(hdc, hiltPen);
+        
+        int hiltSize = 8;
+        if (facing == Direction::Right || facing == Direction::Left) {
+            MoveToEx(hdc, startX, startY - hiltSize, NULL);
+            LineTo(hdc, startX, startY + hiltSize);
+        } else {
+            MoveToEx(hdc, startX - hiltSize, startY, NULL);
+            LineTo(hdc, startX + hiltSize, startY);
+        }
+    }
+    
+    SelectObject(hdc, oldPen);
+}
+
+void EntityRenderer::DrawHeroStatus(HDC hdc, const Hero& hero, Vector2D cameraOffset) {
+    if (!hero.IsAlive()) return;
+    
+    Vector2D position = hero.GetInterpolatedPosition(alpha_);
+    int screenX = (int)(position.x - cameraOffset.x);
+    int screenY = (int)(position.y - cameraOffset.y) - hero.GetSize()/2 - 35;
+    
+    SetBkMode(hdc, TRANSPARENT);
+    SetTextAlign(hdc, TA_CENTER);
+    
+    HFONT font = cache_->GetFont(14, FW_BOLD);
+    HFONT oldFont = (HFONT)SelectObject(hdc, font);
+    
+    SetTextColor(hdc, RGB(255, 215, 0));
+    heroLevelLabel_.Format(L"Lv.%d ★", hero.GetLevel());
+    text_->Draw(hdc, screenX, screenY, heroLevelLabel_.GetText(), heroLevelLabel_.GetLength());
+    
+    int barWidth = 50;
+    int barHeight = 6;
+    int barY = screenY + 15;
+    
+    if (drawBars_) {
+        HBRUSH bgBrush = cache_->GetBrush(RGB(60, 60, 60));
+        RECT bgRect = { screenX - barWidth/2, barY, screenX + barWidth/2, barY + barHeight };
+        FillRect(hdc, &bgRect, bgBrush);
+        
+        float hpRatio = (float)hero.GetCurrentHp() / hero.GetMaxHp();
+        int hpWidth = (int)(barWidth * hpRatio);
+        COLORREF hpColor = hpRatio > 0.5f ? RGB(0, 200, 0) : 
+                           hpRatio > 0.25f ? RGB(255, 165, 0) : RGB(200, 0, 0);
+        HBRUSH hpBrush = cache_->GetBrush(hpColor);
+        RECT hpRect = { screenX - barWidth/2, barY, screenX - barWidth/2 + hpWidth, barY + barHeight };
+        FillRect(hdc, &hpRect, hpBrush);
+    }
+    
+    SetTextColor(hdc, RGB(255, 255, 255));
+    heroHpLabel_.Format(L"%d/%d", hero.GetCurrentHp(), hero.GetMaxHp());
+    text_->Draw(hdc, screenX, barY + 8, heroHpLabel_.GetText(), heroHpLabel_.GetLength());
+    
+    SelectObject(hdc, oldFont);
+}
+
+// ============================================================================
+// 怪獸
+// ============================================================================
+void EntityRenderer::DrawMonster(HDC hdc, const Monster& monster, Vector2D cameraOffset) {
+    if (!monster.IsAlive()) return;
+    
+    Vector2D position = monster.GetInterpolatedPosition(alpha_);
+    int screenX = (int)(position.x - cameraOffset.x);
+    int screenY = (int)(position.y - cameraOffset.y);
+    
+    if (IsUsingSprites()) {
+        atlas_.Draw(hdc, MonsterCell(monster.GetLevel()), screenX, screenY);
+    } else {
+        DrawMonsterShape(hdc, monster.GetLevel(), screenX, screenY);
+    }
+}
+
+void EntityRenderer::DrawMonsterShape(HDC hdc, int level, int screenX, int screenY) {
+    HBRUSH bodyBrush = cache_->GetBrush(content_->GetMonsterColor(level));
+    HBRUSH oldBrush = (HBRUSH)SelectObject(hdc, bodyBrush);
+    
+    POINT body[6];
+    int r = MONSTER_SIZE / 2;
+    for (int i = 0; i < 6; i++) {
+        float angle = (float)i * 3.14159f / 3.0f - 3.14159f / 6.0f;
+        body[i].x = screenX + (int)(r * cos(angle));
+        body[i].y = screenY + (int)(r * sin(angle));
+    }
+    Polygon(hdc, body, 6);
+    
+    HBRUSH hornBrush = cache_->GetBrush(RGB(100, 50, 50));
+    SelectObject(hdc, hornBrush);
+    
+    POINT leftHorn[3] = {
+        { screenX - r/2, screenY - r/2 },
+        { screenX - r/3, screenY - r - 10 },
+        { screenX, screenY - r/2 }
+    };
+    Polygon(hdc, leftHorn, 3);
+    
+    POINT rightHorn[3] = {
+        { screenX, screenY - r/2 },
+        { screenX + r/3, screenY - r - 10 },
+        { screenX + r/2, screenY - r/2 }
+    };
+    Polygon(hdc, rightHorn, 3);
+    
+    HBRUSH eyeBrush = cache_->GetBrush(RGB(255, 0, 0));
+    SelectObject(hdc, eyeBrush);
+    
+    int eyeSize = 5;
+    Ellipse(hdc, screenX - r/3 - eyeSize, screenY - eyeSize - 3,
+            screenX - r/3 + eyeSize, screenY + eyeSize - 3);
+    Ellipse(hdc, screenX + r/3 - eyeSize, screenY - eyeSize - 3,
+            screenX + r/3 + eyeSize, screenY + eyeSize - 3);
+    
+    HPEN mouthPen = cache_->GetPen(PS_SOLID, 2, RGB(0, 0, 0));
+    HPEN oldPen = (HPEN)SelectObject(hdc, mouthPen);
+    
+    MoveToEx(hdc, screenX - r/3, screenY + r/4, NULL);
+    LineTo(hdc, screenX - r/6, screenY + r/3);
+    LineTo(hdc, screenX, screenY + r/4);
+    LineTo(hdc, screenX + r/6, screenY + r/3);
+    LineTo(hdc, screenX + r/3, screenY + r/4);
+    
+    SelectObject(hdc, oldPen);
+    SelectObject(hdc, oldBrush);
+}
+
+void EntityRenderer::DrawMonsterStatus(HDC hdc, const Monster& monster, Vector2D cameraOffset) {
+    if (!monster.IsAlive()) return;
+    
+    Vector2D position = monster.GetInterpolatedPosition(alpha_);
+    int screenX = (int)(position.x - cameraOffset.x);
+    int screenY = (int)(position.y - cameraOffset.y) - monster.GetSize()/2 - 25;
+    
+    SetBkMode(hdc, TRANSPARENT);
+    SetTextAlign(hdc, TA_CENTER);
+    
+    HFONT font = cache_->GetFont(12, FW_BOLD);
+    HFONT oldFont = (HFONT)SelectObject(hdc, font);
+    
+    SetTextColor(hdc, RGB(255, 50, 50));
+    // 同等級的怪獸共用同一個標籤，只在第一次遇到時格式化
+    TextLabel& levelLabel = monsterLevelLabels_[MonsterCell(monster.GetLevel())];
+    levelLabel.Format(L"Lv.%d", monster.GetLevel());
+    text_->Draw(hdc, screenX, screenY, levelLabel.GetText(), levelLabel.GetLength());
+    
+    if (drawBars_) {
+        int barWidth = 40;
+        int barHeight = 4;
+        int barY = screenY + 12;
+        
+        HBRUSH bgBrush = cache_->GetBrush(RGB(60, 60, 60));
+        RECT bgRect = { screenX - barWidth/2, barY, screenX + barWidth/2, barY + barHeight };
+        FillRect(hdc, &bgRect, bgBrush);
+        
+        float hpRatio = (float)monster.GetCurrentHp() / monster.GetMaxHp();
+        int hpWidth = (int)(barWidth * hpRatio);
+        HBRUSH hpBrush = cache_->GetBrush(RGB(200, 0, 0));
+        RECT hpRect = { screenX - barWidth/2, barY, screenX - barWidth/2 + hpWidth, barY + barHeight };
+        FillRect(hdc, &hpRect, hpBrush);
+    }
+    
+    SelectObject(hdc, oldFont);
+}
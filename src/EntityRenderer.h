@@ -0,0 +1,73 @@
+#pragma once
+#include <windows.h>
+#include "Character.h"
+#include "ContentDatabase.h"
+#include "GdiCache.h"
+#include "MonsterPool.h"
+#include "SpriteAtlas.h"
+#include "TextCache.h"
+#include "TextLabel.h"
+
+// ============================================================================
+// 角色繪製（GDI）
+// 模擬核心不含任何繪圖程式碼，僅由 Win32 前端使用
+// 角色外觀只取決於（等級、面向、武器），啟動時預先畫進精靈圖集，
+// 每幀每個角色只需一次遮罩貼圖；關閉圖集時改回逐一呼叫 GDI 繪圖
+// ============================================================================
+class EntityRenderer {
+private:
+    GdiCache* cache_;        // 共用的 GDI 物件快取
+    TextCache* text_;        // 共用的文字點陣圖快取
+    const ContentDatabase* content_;    // 怪獸顏色與武器定義
+    SpriteAtlas atlas_;      // 預先繪製的角色圖
+    bool useSprites_;        // 是否使用精靈圖集
+    bool drawBars_;          // 是否繪製血條（軟體繪圖時血條已畫進像素緩衝區，這裡只補文字）
+    double spriteBuildMs_;   // 建立圖集耗時（毫秒）
+    float alpha_;            // 繪製內插係數（0 = 上一個模擬步，1 = 目前模擬步）
+
+    // 頭上文字（數值改變時才重新格式化）
+    TextLabel heroLevelLabel_;
+    TextLabel heroHpLabel_;
+
+    // 圖集格子編號
+    static constexpr int MONSTER_VARIANTS = 10;     // 等級 1-9，其餘等級共用第 0 格
+    static constexpr int FACING_VARIANTS = 5;       // Direction 的數量
+    static constexpr int WEAPON_VARIANTS = 17;      // 未裝備 + 前 16 把武器，其餘武器改用向量繪圖
+    static int MonsterCell(int level);
+    static int HeroCell(Direction facing, int weaponIndex);
+    TextLabel monsterLevelLabels_[MONSTER_VARIANTS];    // 依圖集格子，每個等級一個
+
+    // 向量繪圖（建立圖集與關閉圖集時使用）
+    void DrawHeroShape(HDC hdc, Direction facing, const WeaponStats& weapon, int screenX, int screenY);
+    void DrawWeapon(HDC hdc, Direction facing, const WeaponStats& weapon, Vector2D screenPos);
+    void DrawMonsterShape(HDC hdc, int level, int screenX, int screenY);
+
+public:
+    EntityRenderer(GdiCache* cache, TextCache* text)
+        : cache_(cache), text_(text), content_(&ContentDatabase::GetDefault())
+        , useSprites_(true), drawBars_(true), spriteBuildMs_(0), alpha_(1.0f) {}
+    
+    // 內容資料（更換後需重新呼叫 BuildSprites）
+    void SetContent(const ContentDatabase* content) { content_ = content; }
+    
+    // 角色位置在兩個模擬步之間的內插係數
+    void SetInterpolation(float alpha) { alpha_ = alpha; }
+
+    // 精靈圖集
+    void BuildSprites();
+    void ReleaseSprites() { atlas_.Release(); }
+    void SetUseSprites(bool enabled) { useSprites_ = enabled; }
+    bool IsUsingSprites() const { return useSprites_ && atlas_.IsReady(); }
+    double GetSpriteBuildMs() const { return spriteBuildMs_; }
+
+    // 狀態列
+    void SetDrawBars(bool enabled) { drawBars_ = enabled; }
+
+    // 英雄
+    void DrawHero(HDC hdc, const Hero& hero, Vector2D cameraOffset);
+    void DrawHeroStatus(HDC hdc, const Hero& hero, Vector2D cameraOffset);
+
+    // 怪獸
+    void DrawMonster(HDC hdc, const Monster& monster, Vector2D cameraOffset);
+    void DrawMonsterStatus(HDC hdc, const Monster& monster, Vector2D cameraOffset);
+};
@@ -0,0 +1,103 @@
+#include "EventBus.h"
+
+// ============================================================================
+// 事件建構
+// ============================================================================
+GameEvent GameEvent::MakeDamageDealt(int monsterId, int damage, int remainingHp, bool toHero, Vector2D pos) {
+    GameEvent event;
+    event.type = GameEventType::DamageDealt;
+    event.damageDealt = { monsterId, damage, remainingHp, toHero, pos.x, pos.y };
+    return event;
+}
+
+GameEvent GameEvent::MakeMonsterKilled(int monsterId, int level, int experience, Vector2D pos) {
+    GameEvent event;
+    event.type = GameEventType::MonsterKilled;
+    event.monsterKilled = { monsterId, level, experience, pos.x, pos.y };
+    return event;
+}
+
+GameEvent GameEvent::MakeLevelUp(int level) {
+    GameEvent event;
+    event.type = GameEventType::LevelUp;
+    event.levelUp = { level };
+    return event;
+}
+
+GameEvent GameEvent::MakeStateChanged(GameState from, GameState to) {
+    GameEvent event;
+    event.type = GameEventType::StateChanged;
+    event.stateChanged = { from, to };
+    return event;
+}
+
+// ============================================================================
+// 環狀緩衝區
+// ============================================================================
+EventBus::EventBus(int capacity)
+    : capacity_(2)
+    , head_(0)
+    , tail_(0)
+    , published_(0)
+    , dropped_(0)
+{
+    while ((int)capacity_ < capacity) capacity_ <<= 1;
+    mask_ = capacity_ - 1;
+    slots_.reset(new Slot[capacity_]);
+    for (uint32_t i = 0; i < capacity_; i++) {
+        slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool EventBus::Publish(const GameEvent& event) {
+    uint32_t pos = head_.load(std::memory_order_relaxed);
+    Slot* slot;
+    for (;;) {
+        slot = &slots_[pos & mask_];
+        int32_t diff = (int32_t)(slot->sequence.load(std::memory_order_acquire) - pos);
+        if (diff == 0) {
+            // 槽位空著：搶下這個位置（失敗時 pos 會更新成最新值再試）
+            if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            // 槽位還存著上一圈未讀取的事件：緩衝區已滿
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            // 其他發布端已搶先寫入
+            pos = head_.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->event = event;
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    published_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+int EventBus::Drain(GameEvent* out, int maxCount) {
+    uint32_t pos = tail_.load(std::memory_order_relaxed);
+    int count = 0;
+    while (count < maxCount) {
+        Slot& slot = slots_[pos & mask_];
+        // 已搶下位置但還沒寫完的事件留到下次，保持發布順序
+        if (slot.sequence.load(std::memory_order_acquire) != pos + 1) break;
+
+        out[count++] = slot.event;
+        slot.sequence.store(pos + capacity_, std::memory_order_release);
+        pos++;
+    }
+    tail_.store(pos, std::memory_order_release);
+    return count;
+}
+
+void EventBus::Clear() {
+    uint32_t pos = tail_.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot& slot = slots_[pos & mask_];
+        if (slot.sequence.load(std::memory_order_acquire) != pos + 1) break;
+
+        slot.sequence.store(pos + capacity_, std::memory_order_release);
+        pos++;
+    }
+    tail_.store(pos, std::memory_order_release);
+}
@@ -0,0 +1,102 @@
+#pragma once
+#include "Types.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// ============================================================================
+// 遊戲事件
+// 模擬核心在結算當下發布，畫面端（HUD、統計、特效）每幀整批取出後各自處理
+// ============================================================================
+enum class GameEventType : uint8_t {
+    DamageDealt,     // 造成傷害（英雄打怪獸或怪獸打英雄）
+    MonsterKilled,   // 怪獸死亡
+    LevelUp,         // 英雄升級（一次獲得多級時每級各一筆）
+    StateChanged     // 遊戲狀態切換
+};
+
+struct DamageDealtEvent {
+    int monsterId;           // 受擊或出手的怪獸
+    int damage;              // 實際扣掉的生命（不含超出剩餘生命的部分）
+    int remainingHp;         // 受擊方的剩餘生命
+    bool toHero;             // true 表示怪獸打英雄
+    float x;                 // 怪獸位置（左上角）
+    float y;
+};
+
+struct MonsterKilledEvent {
+    int monsterId;
+    int level;
+    int experience;          // 給予英雄的經驗
+    float x;
+    float y;
+};
+
+struct LevelUpEvent {
+    int level;               // 升級後的等級
+};
+
+struct StateChangedEvent {
+    GameState from;
+    GameState to;
+};
+
+struct GameEvent {
+    GameEventType type;
+    union {
+        DamageDealtEvent damageDealt;
+        MonsterKilledEvent monsterKilled;
+        LevelUpEvent levelUp;
+        StateChangedEvent stateChanged;
+    };
+
+    static GameEvent MakeDamageDealt(int monsterId, int damage, int remainingHp, bool toHero, Vector2D pos);
+    static GameEvent MakeMonsterKilled(int monsterId, int level, int experience, Vector2D pos);
+    static GameEvent MakeLevelUp(int level);
+    static GameEvent MakeStateChanged(GameState from, GameState to);
+};
+
+// ============================================================================
+// 事件匯流排（固定容量環狀緩衝區）
+// 每個槽位帶一個序號，發布端以 CAS 搶下寫入位置、讀取端以序號確認資料已寫完，
+// 多個執行緒可同時發布而不需要鎖；讀取端只有一個（畫面執行緒）
+// 緩衝區滿時捨棄新事件並計數，模擬端永遠不會等待讀取端；建構之後不再配置記憶體
+// ============================================================================
+class EventBus {
+public:
+    static constexpr int DEFAULT_CAPACITY = 4096;
+
+private:
+    struct Slot {
+        std::atomic<uint32_t> sequence;      // 等於寫入位置時可寫；等於寫入位置 + 1 時可讀
+        GameEvent event;
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    uint32_t capacity_;                      // 2 的次方
+    uint32_t mask_;
+    std::atomic<uint32_t> head_;             // 下一個寫入位置（發布端共用）
+    std::atomic<uint32_t> tail_;             // 下一個讀取位置（只有讀取端修改）
+    std::atomic<uint32_t> published_;        // 累計發布成功數
+    std::atomic<uint32_t> dropped_;          // 累計因緩衝區已滿而捨棄的數量
+
+public:
+    // capacity 向上取整到 2 的次方
+    explicit EventBus(int capacity = DEFAULT_CAPACITY);
+    EventBus(const EventBus&) = delete;
+    EventBus& operator=(const EventBus&) = delete;
+
+    // 發布端：緩衝區已滿時回傳 false（事件被捨棄）
+    bool Publish(const GameEvent& event);
+
+    // 讀取端：依發布順序取出最多 maxCount 筆到 out，回傳取出數
+    int Drain(GameEvent* out, int maxCount);
+    // 讀取端：丟棄所有尚未取出的事件
+    void Clear();
+
+    // 存取方法
+    int GetCapacity() const { return (int)capacity_; }
+    int GetPending() const { return (int)(head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire)); }
+    uint32_t GetPublished() const { return published_.load(std::memory_order_relaxed); }
+    uint32_t GetDropped() const { return dropped_.load(std::memory_order_relaxed); }
+};
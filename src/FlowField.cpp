@@ -0,0 +1,122 @@
+#include "FlowField.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cmath>
+
+FlowField::FlowField(int worldWidth, int worldHeight, int cellSize)
+    : cellSize_(cellSize)
+    , inverseCellSize_(1.0f / cellSize)
+    , targetCell_(-1)
+    , rebuildCount_(0)
+    , lastBuildMs_(0)
+{
+    cols_ = (worldWidth + cellSize - 1) / cellSize;
+    rows_ = (worldHeight + cellSize - 1) / cellSize;
+    distance_.assign(cols_ * rows_, UNREACHABLE);
+    direction_.assign(cols_ * rows_, (uint8_t)Direction::None);
+    frontier_.reserve(cols_ * rows_);
+}
+
+int FlowField::CellOf(Vector2D pos) const {
+    int cx = std::max(0, std::min((int)(pos.x * inverseCellSize_), cols_ - 1));
+    int cy = std::max(0, std::min((int)(pos.y * inverseCellSize_), rows_ - 1));
+    return cy * cols_ + cx;
+}
+
+bool FlowField::SetTarget(Vector2D target) {
+    target_ = target;
+    int cell = CellOf(target);
+    if (cell == targetCell_) return false;
+
+    targetCell_ = cell;
+    Rebuild();
+    return true;
+}
+
+void FlowField::Rebuild() {
+    uint64_t startNs = Profiler::NowNs();
+
+    std::fill(distance_.begin(), distance_.end(), UNREACHABLE);
+    frontier_.clear();
+    distance_[targetCell_] = 0;
+    frontier_.push_back(targetCell_);
+
+    // 四鄰格廣度優先搜尋（每步成本相同，等同 Dijkstra）
+    for (size_t head = 0; head < frontier_.size(); head++) {
+        int cell = frontier_[head];
+        int cx = cell % cols_;
+        int cy = cell / cols_;
+        uint16_t next = (uint16_t)(distance_[cell] + 1);
+        if (cx > 0 && distance_[cell - 1] == UNREACHABLE) {
+            distance_[cell - 1] = next;
+            frontier_.push_back(cell - 1);
+        }
+        if (cx < cols_ - 1 && distance_[cell + 1] == UNREACHABLE) {
+            distance_[cell + 1] = next;
+            frontier_.push_back(cell + 1);
+        }
+        if (cy > 0 && distance_[cell - cols_] == UNREACHABLE) {
+            distance_[cell - cols_] = next;
+            frontier_.push_back(cell - cols_);
+        }
+        if (cy < rows_ - 1 && distance_[cell + cols_] == UNREACHABLE) {
+            distance_[cell + cols_] = next;
+            frontier_.push_back(cell + cols_);
+        }
+    }
+
+    // 每格選一個步數少一的鄰格；有兩個可選時走離目標較遠的軸，路線接近斜線而不是先橫後直
+    const int tx = targetCell_ % cols_;
+    const int ty = targetCell_ / cols_;
+    for (int cell = 0; cell < cols_ * rows_; cell++) {
+        Direction dir = Direction::None;
+        uint16_t d = distance_[cell];
+        if (d != 0 && d != UNREACHABLE) {
+            int cx = cell % cols_;
+            int cy = cell / cols_;
+            Direction horizontal = Direction::None;
+            Direction vertical = Direction::None;
+            if (cx > 0 && distance_[cell - 1] < d) horizontal = Direction::Left;
+            if (cx < cols_ - 1 && distance_[cell + 1] < d) horizontal = Direction::Right;
+            if (cy > 0 && distance_[cell - cols_] < d) vertical = Direction::Up;
+            if (cy < rows_ - 1 && distance_[cell + cols_] < d) vertical = Direction::Down;
+
+            if (horizontal != Direction::None && vertical != Direction::None) {
+                dir = std::abs(cx - tx) >= std::abs(cy - ty) ? horizontal : vertical;
+            } else {
+                dir = horizontal != Direction::None ? horizontal : vertical;
+            }
+        }
+        direction_[cell] = (uint8_t)dir;
+    }
+
+    rebuildCount_++;
+    lastBuildMs_ = (Profiler::NowNs() - startNs) / 1e6;
+}
+
+Direction FlowField::GetDirection(Vector2D pos) const {
+    int distance;
+    return GetDirection(pos, distance);
+}
+
+Direction FlowField::GetDirection(Vector2D pos, int& distance) const {
+    if (targetCell_ < 0) {
+        distance = UNREACHABLE;
+        return Direction::None;
+    }
+
+    int cell = CellOf(pos);
+    distance = distance_[cell];
+    if (cell != targetCell_) {
+        return static_cast<Direction>(direction_[cell]);
+    }
+
+    // 與目標同格：直接朝目標較遠的軸移動
+    float dx = target_.x - pos.x;
+    float dy = target_.y - pos.y;
+    if (std::fabs(dx) < 1.0f && std::fabs(dy) < 1.0f) return Direction::None;
+    if (std::fabs(dx) >= std::fabs(dy)) {
+        return dx > 0 ? Direction::Right : Direction::Left;
+    }
+    return dy > 0 ? Direction::Down : Direction::Up;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include "Types.h"
+#include <cstdint>
+#include <vector>
+
+// ============================================================================
+// 追擊流場（Dijkstra map）
+// 以 TILE_SIZE 為格，從目標所在格做廣度優先搜尋，記錄每格到目標的步數與下一步方向；
+// 目標換格時才重建，同一格內移動不需要重算
+// 查詢只是一次索引，上萬隻怪獸共用同一張表，不必各自尋路
+// ============================================================================
+class FlowField {
+public:
+    static constexpr uint16_t UNREACHABLE = 0xFFFF;
+
+private:
+    int cellSize_;
+    float inverseCellSize_;
+    int cols_;
+    int rows_;
+    int targetCell_;                     // 目前目標所在格（-1 表示尚未設定）
+    Vector2D target_;                    // 目標位置（同格內直接朝目標移動）
+    std::vector<uint16_t> distance_;     // 每格到目標格的步數
+    std::vector<uint8_t> direction_;     // 每格的下一步方向（Direction）
+    std::vector<int> frontier_;          // 廣度優先搜尋佇列（預先配置）
+    int rebuildCount_;
+    double lastBuildMs_;
+
+    void Rebuild();
+    int CellOf(Vector2D pos) const;
+
+public:
+    FlowField(int worldWidth = GameConstants::MAP_WIDTH,
+              int worldHeight = GameConstants::MAP_HEIGHT,
+              int cellSize = GameConstants::TILE_SIZE);
+
+    // 設定目標；換格時重建並回傳 true
+    bool SetTarget(Vector2D target);
+    void Invalidate() { targetCell_ = -1; }
+
+    // 從 pos 朝目標前進的方向（O(1)）；已在目標附近時回傳 None
+    Direction GetDirection(Vector2D pos) const;
+    // 同上，並一併取得所在格的步數（追擊判斷只需一次格子換算）
+    Direction GetDirection(Vector2D pos, int& distance) const;
+    // pos 所在格到目標格的步數
+    int GetDistance(Vector2D pos) const { return targetCell_ < 0 ? UNREACHABLE : distance_[CellOf(pos)]; }
+
+    // 存取方法
+    int GetRebuildCount() const { return rebuildCount_; }
+    double GetLastBuildMs() const { return lastBuildMs_; }
+};
@@ -0,0 +1,49 @@
+#include "FrameTimer.h"
+#include <mmsystem.h>
+
+#pragma comment(lib, "winmm.lib")
+
+FrameTimer::FrameTimer(int targetFps)
+    : targetFps_(0)
+    , periodRaised_(false)
+{
+    QueryPerformanceFrequency(&frequency_);
+    QueryPerformanceCounter(&frameStart_);
+    SetTargetFps(targetFps);
+    
+    // 預設的 Sleep 解析度約 15ms，無法穩定維持 60 FPS
+    periodRaised_ = timeBeginPeriod(1) == TIMERR_NOERROR;
+}
+
+FrameTimer::~FrameTimer() {
+    if (periodRaised_) {
+        timeEndPeriod(1);
+    }
+}
+
+double FrameTimer::BeginFrame() {
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    double elapsed = (double)(now.QuadPart - frameStart_.QuadPart) / frequency_.QuadPart;
+    frameStart_ = now;
+    return elapsed;
+}
+
+void FrameTimer::WaitForNextFrame() {
+    if (targetFps_ <= 0) return;
+    
+    LONGLONG deadline = frameStart_.QuadPart + frequency_.QuadPart / targetFps_;
+    LARGE_INTEGER now;
+    QueryPerformanceCounter(&now);
+    
+    // 距離期限較遠時先 Sleep 讓出 CPU，最後不到 2ms 改為忙碌等待以求準確
+    while (now.QuadPart < deadline) {
+        LONGLONG remainingMs = (deadline - now.QuadPart) * 1000 / frequency_.QuadPart;
+        if (remainingMs > 2) {
+            Sleep((DWORD)(remainingMs - 1));
+        } else {
+            YieldProcessor();
+        }
+        QueryPerformanceCounter(&now);
+    }
+}
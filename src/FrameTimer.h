@@ -0,0 +1,31 @@
+#pragma once
+#include <windows.h>
+
+// ============================================================================
+// 高精度幀計時器
+// 以 QueryPerformanceCounter 量測幀間隔，並依設定的幀率上限等待下一幀；
+// 幀率上限為 0 時不等待（不限幀率）
+// ============================================================================
+class FrameTimer {
+private:
+    LARGE_INTEGER frequency_;    // 計數器頻率（每秒計數）
+    LARGE_INTEGER frameStart_;   // 本幀開始時間
+    int targetFps_;              // 幀率上限（0 = 不限）
+    bool periodRaised_;          // 是否已提高系統計時器解析度
+
+public:
+    explicit FrameTimer(int targetFps = 60);
+    ~FrameTimer();
+
+    FrameTimer(const FrameTimer&) = delete;
+    FrameTimer& operator=(const FrameTimer&) = delete;
+
+    // 開始新的一幀，回傳距上一幀開始的秒數
+    double BeginFrame();
+
+    // 依幀率上限等待到下一幀的開始時間
+    void WaitForNextFrame();
+
+    void SetTargetFps(int fps) { targetFps_ = fps > 0 ? fps : 0; }
+    int GetTargetFps() const { return targetFps_; }
+};
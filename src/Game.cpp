@@ -1,69 +1,76 @@
 #include "Game.h"
-#include <cstdlib>
-#include <ctime>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
 
 using namespace GameConstants;
 
-Game::Game()
-    : gameState_(GameState::WeaponSelect)
-    , lastUpdateTime_(0)
+Game::Game(uint64_t seed, const std::wstring& contentPath)
+    : contentPath_(contentPath)
+    , simulation_(&clock_)
+    , accumulator_(0)
+    , interpolation_(1.0f)
+    , entityRenderer_(&gdiCache_, &textCache_)
+    , backgroundLayer_(&gdiCache_)
+    , backend_(RenderBackend::Gdi)
+    , minimapDC_(nullptr)
+    , minimapBitmap_(nullptr)
+    , minimapOldBitmap_(nullptr)
+    , drawnCount_(0)
+    , culledCount_(0)
+    , eventsThisFrame_(0)
+    , levelUpTimer_(0)
+    , levelUpLevel_(0)
+    , damageDealt_(0)
+    , damageTaken_(0)
     , memDC_(nullptr)
     , memBitmap_(nullptr)
+    , dibBitmap_(nullptr)
     , oldBitmap_(nullptr)
     , bufferWidth_(0)
     , bufferHeight_(0)
     , fps_(0)
     , frameCount_(0)
     , fpsTimer_(0)
+    , showProfiler_(false)
+    , traceMessage_(nullptr)
 {
-    srand((unsigned int)time(nullptr));
-    
-    ZeroMemory(keyStates_, sizeof(keyStates_));
+    simulation_.SetSeed(seed);
+    simulation_.SetProfiler(&profiler_);
+    simulation_.SetJobSystem(&jobSystem_);
+    eventBatch_.resize(simulation_.GetEvents().GetCapacity());
     
     cameraOffset_ = Vector2D(0, 0);
 }
 
 Game::~Game() {
+    SaveRecording();
     DeleteBackBuffer();
 }
 
 bool Game::Initialize(HWND hWnd) {
-    CreateBackBuffer(hWnd);
-    
-    Vector2D heroPos((float)MAP_WIDTH / 2, (float)MAP_HEIGHT / 2);
-    hero_ = std::make_unique<Hero>(heroPos);
+    // 快取有效時直接映射；否則解析原始檔並重寫快取；兩者都沒有時沿用內建內容
+    if (content_.Load(contentPath_, CONTENT_CACHE) == ContentDatabase::LoadResult::Failed) {
+        // 檔案存在但有誤時不要默默換成內建內容：顯示錯誤原因（含行號）
+        const std::string& error = content_.GetError();
+        wchar_t reason[256] = {};
+        MultiByteToWideChar(CP_UTF8, 0, error.c_str(), -1, reason, 255);
+        wchar_t message[400];
+        swprintf_s(message, L"內容載入失敗，改用%s內容：\n%s",
+                   content_.GetSource() == ContentDatabase::Source::Cache ? L"上次的快取" : L"內建", reason);
+        MessageBox(hWnd, message, L"內容錯誤", MB_ICONWARNING);
+    }
+    simulation_.SetContent(&content_);
+    entityRenderer_.SetContent(&content_);
+    softwareRenderer_.SetContent(&content_);
     
-    InitializeMonsters();
+    CreateBackBuffer(hWnd);
     
-    lastUpdateTime_ = GetTickCount();
-    fpsTimer_ = lastUpdateTime_;
+    simulation_.Reset();
     
     return true;
 }
 
-void Game::InitializeMonsters() {
-    monsters_.clear();
-    
-    for (int i = 0; i < INITIAL_MONSTER_COUNT; i++) {
-        Vector2D pos;
-        do {
-            pos.x = (float)(rand() % (MAP_WIDTH - 100) + 50);
-            pos.y = (float)(rand() % (MAP_HEIGHT - 100) + 50);
-        } while (hero_ && pos.DistanceTo(hero_->GetPosition()) < 200);
-        
-        int level;
-        int roll = rand() % 100;
-        if (roll < 40) level = 1;
-        else if (roll < 65) level = 2;
-        else if (roll < 80) level = 3;
-        else if (roll < 90) level = 4;
-        else if (roll < 95) level = 5;
-        else level = 6 + rand() % 4;
-        
-        monsters_.push_back(std::make_unique<Monster>(pos, level));
-    }
-}
-
 void Game::CreateBackBuffer(HWND hWnd) {
     HDC hdc = GetDC(hWnd);
     
@@ -72,170 +79,223 @@ void Game::CreateBackBuffer(HWND hWnd) {
     
     memDC_ = CreateCompatibleDC(hdc);
     memBitmap_ = CreateCompatibleBitmap(hdc, bufferWidth_, bufferHeight_);
-    oldBitmap_ = (HBITMAP)SelectObject(memDC_, memBitmap_);
+    
+    // 32 位元、由上而下的 DIB section：像素格式與 Rasterizer 相同，可直接寫入
+    BITMAPINFO info = {};
+    info.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+    info.bmiHeader.biWidth = bufferWidth_;
+    info.bmiHeader.biHeight = -bufferHeight_;
+    info.bmiHeader.biPlanes = 1;
+    info.bmiHeader.biBitCount = 32;
+    info.bmiHeader.biCompression = BI_RGB;
+    void* bits = nullptr;
+    dibBitmap_ = CreateDIBSection(hdc, &info, DIB_RGB_COLORS, &bits, NULL, 0);
+    if (dibBitmap_) {
+        frameBuffer_.Attach((uint32_t*)bits, bufferWidth_, bufferHeight_, bufferWidth_);
+    } else {
+        backend_ = RenderBackend::Gdi;
+    }
+    
+    oldBitmap_ = (HBITMAP)SelectObject(memDC_, backend_ == RenderBackend::Software ? dibBitmap_ : memBitmap_);
+    
+    // 小地圖圖層：同樣格式的小 DIB section
+    info.bmiHeader.biWidth = MINIMAP_WIDTH;
+    info.bmiHeader.biHeight = -MINIMAP_HEIGHT;
+    bits = nullptr;
+    minimapBitmap_ = CreateDIBSection(hdc, &info, DIB_RGB_COLORS, &bits, NULL, 0);
+    if (minimapBitmap_) {
+        minimapDC_ = CreateCompatibleDC(hdc);
+        minimapOldBitmap_ = (HBITMAP)SelectObject(minimapDC_, minimapBitmap_);
+        minimap_.Attach((uint32_t*)bits, MINIMAP_WIDTH, MINIMAP_HEIGHT, MINIMAP_WIDTH);
+    }
     
     ReleaseDC(hWnd, hdc);
+    
+    backgroundLayer_.Initialize(MAP_WIDTH, MAP_HEIGHT, bufferWidth_, bufferHeight_);
+    entityRenderer_.BuildSprites();
+    softwareRenderer_.BuildSprites();
+    textCache_.Initialize();
+}
+
+void Game::SetBackend(RenderBackend backend) {
+    if (backend == RenderBackend::Software && !frameBuffer_.IsReady()) return;
+    
+    backend_ = backend;
+    entityRenderer_.SetDrawBars(backend_ == RenderBackend::Gdi);
+    if (memDC_) {
+        SelectObject(memDC_, backend_ == RenderBackend::Software ? dibBitmap_ : memBitmap_);
+    }
 }
 
 void Game::DeleteBackBuffer() {
+    backgroundLayer_.Release();
+    entityRenderer_.ReleaseSprites();
+    textCache_.Release();
+    
     if (memDC_) {
         SelectObject(memDC_, oldBitmap_);
         DeleteObject(memBitmap_);
         DeleteDC(memDC_);
         memDC_ = nullptr;
     }
+    if (dibBitmap_) {
+        frameBuffer_.Detach();
+        DeleteObject(dibBitmap_);
+        dibBitmap_ = nullptr;
+    }
+    if (minimapDC_) {
+        minimap_.Detach();
+        SelectObject(minimapDC_, minimapOldBitmap_);
+        DeleteObject(minimapBitmap_);
+        DeleteDC(minimapDC_);
+        minimapDC_ = nullptr;
+        minimapBitmap_ = nullptr;
+    }
 }
 
-void Game::Update() {
-    DWORD currentTime = GetTickCount();
-    float deltaTime = (currentTime - lastUpdateTime_) / 1000.0f;
-    lastUpdateTime_ = currentTime;
+void Game::Update(double frameSeconds) {
+    profiler_.BeginFrame();
     
     frameCount_++;
-    if (currentTime - fpsTimer_ >= 1000) {
+    fpsTimer_ += frameSeconds;
+    if (fpsTimer_ >= 1.0) {
         fps_ = frameCount_;
         frameCount_ = 0;
-        fpsTimer_ = currentTime;
-    }
-    
-    switch (gameState_) {
-        case GameState::WeaponSelect:
-            if (IsKeyPressed('1')) {
-                hero_->SetWeapon(WeaponType::Sword);
-                gameState_ = GameState::Playing;
-            } else if (IsKeyPressed('2')) {
-                hero_->SetWeapon(WeaponType::Axe);
-                gameState_ = GameState::Playing;
-            }
-            break;
-            
-        case GameState::Playing:
-            UpdatePlaying(deltaTime);
-            break;
-            
-        case GameState::GameOver:
-        case GameState::Victory:
-            if (IsKeyPressed(VK_SPACE) || IsKeyPressed(VK_RETURN)) {
-                hero_ = std::make_unique<Hero>(
-                    Vector2D((float)MAP_WIDTH / 2, (float)MAP_HEIGHT / 2)
-                );
-                InitializeMonsters();
-                gameState_ = GameState::WeaponSelect;
-            }
-            break;
-    }
-}
-
-void Game::UpdatePlaying(float deltaTime) {
-    if (IsKeyPressed(VK_UP) || IsKeyPressed('W')) {
-        hero_->Move(Direction::Up);
-    }
-    if (IsKeyPressed(VK_DOWN) || IsKeyPressed('S')) {
-        hero_->Move(Direction::Down);
-    }
-    if (IsKeyPressed(VK_LEFT) || IsKeyPressed('A') == false && IsKeyPressed(VK_LEFT)) {
-        hero_->Move(Direction::Left);
-    }
-    if (IsKeyPressed(VK_RIGHT) || IsKeyPressed('D')) {
-        hero_->Move(Direction::Right);
+        fpsTimer_ = 0;
     }
     
-    if (IsKeyPressed('A')) {
-        CheckAttack();
-    } else {
-        hero_->EndAttack();
-    }
-    
-    for (auto& monster : monsters_) {
-        if (monster->IsAlive()) {
-            monster->Update(deltaTime);
+    // 固定步長：累積實際經過的時間，每滿一步就推進一次模擬；
+    // 單幀時間設上限，避免卡頓後一次補跑過多步
+    accumulator_ += std::min(frameSeconds, MAX_FRAME_TIME);
+    while (accumulator_ >= FIXED_TIMESTEP) {
+        if (!recordPath_.empty()) {
+            recording_.RecordTick(input_);
         }
+        simulation_.Tick(input_, FIXED_TIMESTEP);
+        clock_.Advance(FIXED_TIMESTEP * 1000.0);
+        accumulator_ -= FIXED_TIMESTEP;
     }
     
-    UpdateCamera();
+    // 剩餘不足一步的時間作為繪製內插係數
+    interpolation_ = (float)(accumulator_ / FIXED_TIMESTEP);
+    entityRenderer_.SetInterpolation(interpolation_);
+    ProcessEvents(frameSeconds);
     
-    CheckGameOver();
+    if (simulation_.GetState() == GameState::Playing) {
+        UpdateCamera();
+    }
 }
 
-void Game::CheckAttack() {
-    if (!hero_->CanAttack()) return;
-    
-    int damage = hero_->PerformAttack();
-    
-    for (auto& monster : monsters_) {
-        if (!monster->IsAlive()) continue;
-        
-        float distance = hero_->GetPosition().DistanceTo(monster->GetPosition());
-        if (distance <= ATTACK_RANGE) {
-            monster->TakeDamage(damage);
-            
-            if (!monster->IsAlive()) {
-                hero_->GainExperience(monster->GetExperienceReward());
-                hero_->AddKill();
+// 整批取出本幀所有模擬步發布的事件，交給各個畫面端消費者
+void Game::ProcessEvents(double frameSeconds) {
+    levelUpTimer_ = std::max(0.0f, levelUpTimer_ - (float)frameSeconds);
+    
+    EventBus& events = simulation_.GetEvents();
+    eventsThisFrame_ = 0;
+    int count;
+    while ((count = events.Drain(eventBatch_.data(), (int)eventBatch_.size())) > 0) {
+        eventsThisFrame_ += count;
+        for (int i = 0; i < count; i++) {
+            const GameEvent& event = eventBatch_[i];
+            switch (event.type) {
+                case GameEventType::DamageDealt:
+                    if (event.damageDealt.toHero) {
+                        damageTaken_ += event.damageDealt.damage;
+                    } else {
+                        damageDealt_ += event.damageDealt.damage;
+                    }
+                    break;
+                case GameEventType::LevelUp:
+                    levelUpLevel_ = event.levelUp.level;
+                    levelUpTimer_ = LEVEL_UP_BANNER_SECONDS;
+                    break;
+                case GameEventType::StateChanged:
+                    // 新的一局開始時重設本局統計
+                    if (event.stateChanged.to == GameState::Playing) {
+                        damageDealt_ = 0;
+                        damageTaken_ = 0;
+                        levelUpTimer_ = 0;
+                    }
+                    break;
+                default:
+                    break;
             }
-            break;
         }
     }
 }
 
 void Game::UpdateCamera() {
-    Vector2D heroPos = hero_->GetPosition();
-    
-    cameraOffset_.x = heroPos.x - WINDOW_WIDTH / 2.0f;
-    cameraOffset_.y = heroPos.y - WINDOW_HEIGHT / 2.0f;
+    ProfileScope scope(&profiler_, ProfileZone::Camera);
     
-    if (cameraOffset_.x < 0) cameraOffset_.x = 0;
-    if (cameraOffset_.y < 0) cameraOffset_.y = 0;
-    if (cameraOffset_.x > MAP_WIDTH - WINDOW_WIDTH) 
-        cameraOffset_.x = (float)(MAP_WIDTH - WINDOW_WIDTH);
-    if (cameraOffset_.y > MAP_HEIGHT - WINDOW_HEIGHT) 
-        cameraOffset_.y = (float)(MAP_HEIGHT - WINDOW_HEIGHT);
+    Vector2D heroPos = simulation_.GetHero().GetInterpolatedPosition(interpolation_);
+    cameraOffset_ = Simulation::ComputeCameraOffset(heroPos);
 }
 
-void Game::CheckGameOver() {
-    if (!hero_->IsAlive()) {
-        gameState_ = GameState::GameOver;
-        return;
-    }
+void Game::StartRecording(const std::wstring& path) {
+    // 需在第一個模擬步之前開始，重播時才能從相同的初始狀態出發
+    recordPath_ = path;
+    recording_.Begin(simulation_.GetSeed(), simulation_.GetMonsterCount(),
+                     simulation_.GetContent().GetContentHash());
+}
+
+void Game::SaveRecording() {
+    if (recordPath_.empty()) return;
     
-    bool allDead = true;
-    for (const auto& monster : monsters_) {
-        if (monster->IsAlive()) {
-            allDead = false;
-            break;
-        }
-    }
+    std::vector<uint8_t> bytes = recording_.Serialize();
+    FILE* file = nullptr;
+    if (_wfopen_s(&file, recordPath_.c_str(), L"wb") != 0 || !file) return;
     
-    if (allDead) {
-        gameState_ = GameState::Victory;
-    }
+    fwrite(bytes.data(), 1, bytes.size(), file);
+    fclose(file);
 }
 
 void Game::HandleKeyDown(WPARAM key) {
+    // 功能鍵只在按下的瞬間觸發（忽略按住時的重複訊息）
+    if (key < 256 && !input_.IsPressed((int)key)) {
+        switch (key) {
+            case VK_F2:
+                // 切換精靈圖集與逐一 GDI 繪圖，方便比較每幀成本
+                entityRenderer_.SetUseSprites(!entityRenderer_.IsUsingSprites());
+                break;
+            case VK_F3:
+                showProfiler_ = !showProfiler_;
+                break;
+            case VK_F4:
+                traceMessage_ = profiler_.WriteChromeTrace(TRACE_FILE)
+                    ? L"已輸出 herowar_trace.json" : L"trace 輸出失敗";
+                break;
+            case VK_F5:
+                // 切換 GDI 與軟體繪圖後端，比較整幀成本
+                SetBackend(backend_ == RenderBackend::Gdi ? RenderBackend::Software : RenderBackend::Gdi);
+                break;
+            case VK_F6:
+                // 小地圖重畫間隔：1 → 4 → 8 → 16 幀循環
+                minimap_.SetInterval(minimap_.GetInterval() >= 16 ? 1 : std::max(4, minimap_.GetInterval() * 2));
+                break;
+        }
+    }
+    
     if (key < 256) {
-        keyStates_[key] = true;
+        input_.SetKey((int)key, true);
     }
 }
 
 void Game::HandleKeyUp(WPARAM key) {
     if (key < 256) {
-        keyStates_[key] = false;
+        input_.SetKey((int)key, false);
     }
 }
 
-bool Game::IsKeyPressed(int key) const {
-    return key < 256 && keyStates_[key];
-}
-
 void Game::Render(HDC hdc) {
     if (!memDC_) return;
     
+    textCache_.ResetFrameStats();
+    
     RECT rect = { 0, 0, bufferWidth_, bufferHeight_ };
-    HBRUSH bgBrush = CreateSolidBrush(RGB(40, 40, 50));
+    HBRUSH bgBrush = gdiCache_.GetBrush(RGB(40, 40, 50));
     FillRect(memDC_, &rect, bgBrush);
-    DeleteObject(bgBrush);
     
-    switch (gameState_) {
+    switch (simulation_.GetState()) {
         case GameState::WeaponSelect:
             DrawWeaponSelect(memDC_);
             break;
@@ -252,6 +312,11 @@ void Game::Render(HDC hdc) {
             break;
     }
     
+    if (showProfiler_) {
+        DrawProfilerOverlay(memDC_);
+    }
+    
+    ProfileScope scope(&profiler_, ProfileZone::Blit);
     BitBlt(hdc, 0, 0, bufferWidth_, bufferHeight_, memDC_, 0, 0, SRCCOPY);
 }
 
@@ -259,118 +324,134 @@ void Game::DrawWeaponSelect(HDC hdc) {
     SetBkMode(hdc, TRANSPARENT);
     SetTextAlign(hdc, TA_CENTER);
     
-    HFONT titleFont = CreateFont(48, 0, 0, 0, FW_BOLD, FALSE, FALSE, FALSE,
-                                  DEFAULT_CHARSET, OUT_OUTLINE_PRECIS, CLIP_DEFAULT_PRECIS,
-                                  CLEARTYPE_QUALITY, DEFAULT_PITCH, L"Arial");
+    HFONT titleFont = gdiCache_.GetFont(48, FW_BOLD);
     HFONT oldFont = (HFONT)SelectObject(hdc, titleFont);
     
     SetTextColor(hdc, RGB(255, 215, 0));
     TextOut(hdc, WINDOW_WIDTH / 2, 100, L"⚔ HERO WAR ⚔", 14);
     
     SetTextColor(hdc, RGB(200, 200, 200));
-    HFONT subtitleFont = CreateFont(24, 0, 0, 0, FW_NORMAL, FALSE, FALSE, FALSE,
-                                     DEFAULT_CHARSET, OUT_OUTLINE_PRECIS, CLIP_DEFAULT_PRECIS,
-                                     CLEARTYPE_QUALITY, DEFAULT_PITCH, L"Arial");
+    HFONT subtitleFont = gdiCache_.GetFont(24, FW_NORMAL);
     SelectObject(hdc, subtitleFont);
     TextOut(hdc, WINDOW_WIDTH / 2, 160, L"英 雄 戰 爭", 5);
     
-    HFONT menuFont = CreateFont(28, 0, 0, 0, FW_BOLD, FALSE, FALSE, FALSE,
-                                 DEFAULT_CHARSET, OUT_OUTLINE_PRECIS, CLIP_DEFAULT_PRECIS,
-                                 CLEARTYPE_QUALITY, DEFAULT_PITCH, L"Arial");
+    HFONT menuFont = gdiCache_.GetFont(28, FW_BOLD);
     SelectObject(hdc, menuFont);
     
     SetTextColor(hdc, RGB(255, 255, 255));
     TextOut(hdc, WINDOW_WIDTH / 2, 280, L"選擇你的武器", 6);
     
-    int optionY = 350;
-    SetTextColor(hdc, RGB(192, 192, 192));
-    TextOut(hdc, WINDOW_WIDTH / 2, optionY, L"[1] 長劍", 6);
+    // 兩把武器時間距 100；武器較多時壓縮間距，過密時省略說明列
+    int weaponCount = std::min(9, content_.GetWeaponCount());
+    int spacing = weaponCount > 1 ? std::min(100, 200 / (weaponCount - 1)) : 0;
+    HFONT descFont = gdiCache_.GetFont(18, FW_NORMAL);
     
-    HFONT descFont = CreateFont(18, 0, 0, 0, FW_NORMAL, FALSE, FALSE, FALSE,
-                                 DEFAULT_CHARSET, OUT_OUTLINE_PRECIS, CLIP_DEFAULT_PRECIS,
-                                 CLEARTYPE_QUALITY, DEFAULT_PITCH, L"Arial");
-    SelectObject(hdc, descFont);
-    SetTextColor(hdc, RGB(150, 150, 150));
-    TextOut(hdc, WINDOW_WIDTH / 2, optionY + 35, L"攻擊快速 | 傷害: +15 | 攻速: 0.5秒", 20);
-    
-    HPEN swordPen = CreatePen(PS_SOLID, 3, RGB(192, 192, 192));
-    HPEN oldPen = (HPEN)SelectObject(hdc, swordPen);
-    MoveToEx(hdc, WINDOW_WIDTH / 2 - 100, optionY + 15, NULL);
-    LineTo(hdc, WINDOW_WIDTH / 2 - 60, optionY + 15);
-    HPEN hiltPen = CreatePen(PS_SOLID, 2, RGB(139, 69, 19));
-    SelectObject(hdc, hiltPen);
-    MoveToEx(hdc, WINDOW_WIDTH / 2 - 100, optionY + 10, NULL);
-    LineTo(hdc, WINDOW_WIDTH / 2 - 100, optionY + 20);
-    
-    optionY = 450;
-    SelectObject(hdc, menuFont);
-    SetTextColor(hdc, RGB(139, 69, 19));
-    TextOut(hdc, WINDOW_WIDTH / 2, optionY, L"[2] 戰斧", 6);
-    
-    SelectObject(hdc, descFont);
-    SetTextColor(hdc, RGB(150, 150, 150));
-    TextOut(hdc, WINDOW_WIDTH / 2, optionY + 35, L"傷害強大 | 傷害: +30 | 攻速: 1.0秒", 20);
-    
-    HPEN axePen = CreatePen(PS_SOLID, 3, RGB(139, 69, 19));
-    SelectObject(hdc, axePen);
-    MoveToEx(hdc, WINDOW_WIDTH / 2 - 100, optionY + 15, NULL);
-    LineTo(hdc, WINDOW_WIDTH / 2 - 65, optionY + 15);
-    
-    HBRUSH axeBrush = CreateSolidBrush(RGB(100, 100, 100));
-    HBRUSH oldBrush = (HBRUSH)SelectObject(hdc, axeBrush);
-    POINT axeHead[4] = {
-        { WINDOW_WIDTH / 2 - 65, optionY + 5 },
-        { WINDOW_WIDTH / 2 - 55, optionY + 15 },
-        { WINDOW_WIDTH / 2 - 65, optionY + 25 },
-        { WINDOW_WIDTH / 2 - 65, optionY + 5 }
-    };
-    Polygon(hdc, axeHead, 4);
+    for (int i = 0; i < weaponCount; i++) {
+        WeaponStats weapon = content_.GetWeapon(i);
+        int optionY = 350 + i * spacing;
+        
+        wchar_t text[160];
+        SelectObject(hdc, menuFont);
+        SetTextColor(hdc, weapon.color);
+        swprintf_s(text, L"[%d] %.40s", i + 1, weapon.name.c_str());
+        TextOut(hdc, WINDOW_WIDTH / 2, optionY, text, (int)wcslen(text));
+        
+        if (spacing == 0 || spacing >= 60) {
+            SelectObject(hdc, descFont);
+            SetTextColor(hdc, RGB(150, 150, 150));
+            swprintf_s(text, L"%.80s | 傷害: +%d | 攻速: %.1f秒",
+                       weapon.description.c_str(), weapon.damage, weapon.attackSpeed / 1000.0f);
+            TextOut(hdc, WINDOW_WIDTH / 2, optionY + 35, text, (int)wcslen(text));
+        }
+        
+        DrawWeaponIcon(hdc, weapon, WINDOW_WIDTH / 2 - 100, optionY + 15);
+    }
     
     SelectObject(hdc, descFont);
     SetTextColor(hdc, RGB(100, 100, 100));
     TextOut(hdc, WINDOW_WIDTH / 2, 580, L"操作說明：方向鍵移動 | A鍵攻擊 | ESC退出", 23);
     
-    SelectObject(hdc, oldPen);
     SelectObject(hdc, oldFont);
-    SelectObject(hdc, oldBrush);
-    DeleteObject(titleFont);
-    DeleteObject(subtitleFont);
-    DeleteObject(menuFont);
-    DeleteObject(descFont);
-    DeleteObject(swordPen);
-    DeleteObject(hiltPen);
-    DeleteObject(axePen);
-    DeleteObject(axeBrush);
 }
 
-void Game::DrawGame(HDC hdc) {
-    DrawBackground(hdc);
+void Game::DrawWeaponIcon(HDC hdc, const WeaponStats& weapon, int x, int y) {
+    HPEN bladePen = gdiCache_.GetPen(PS_SOLID, 3, weapon.color);
+    HPEN oldPen = (HPEN)SelectObject(hdc, bladePen);
     
-    for (const auto& monster : monsters_) {
-        if (monster->IsAlive()) {
-            monster->Draw(hdc, cameraOffset_);
-            monster->DrawStatus(hdc, cameraOffset_);
-        }
+    if (weapon.type == WeaponType::Axe) {
+        MoveToEx(hdc, x, y, NULL);
+        LineTo(hdc, x + 35, y);
+        
+        HBRUSH axeBrush = gdiCache_.GetBrush(RGB(100, 100, 100));
+        HBRUSH oldBrush = (HBRUSH)SelectObject(hdc, axeBrush);
+        POINT axeHead[4] = {
+            { x + 35, y - 10 },
+            { x + 45, y },
+            { x + 35, y + 10 },
+            { x + 35, y - 10 }
+        };
+        Polygon(hdc, axeHead, 4);
+        SelectObject(hdc, oldBrush);
+    } else {
+        MoveToEx(hdc, x, y, NULL);
+        LineTo(hdc, x + 40, y);
+        HPEN hiltPen = gdiCache_.GetPen(PS_SOLID, 2, RGB(139, 69, 19));
+        SelectObject(hdc, hiltPen);
+        MoveToEx(hdc, x, y - 5, NULL);
+        LineTo(hdc, x, y + 5);
     }
     
-    if (hero_->IsAlive()) {
-        hero_->Draw(hdc, cameraOffset_);
-        hero_->DrawStatus(hdc, cameraOffset_);
+    SelectObject(hdc, oldPen);
+}
+
+void Game::DrawGame(HDC hdc) {
+    if (backend_ == RenderBackend::Software) {
+        DrawWorldSoftware(hdc);
+    } else {
+        DrawBackground(hdc);
+        DrawEntities(hdc);
     }
     
-    if (hero_->IsAttacking()) {
-        HPEN rangePen = CreatePen(PS_DOT, 1, RGB(255, 100, 100));
+    const Hero& hero = simulation_.GetHero();
+    if (hero.IsAttacking()) {
+        HPEN rangePen = gdiCache_.GetPen(PS_DOT, 1, RGB(255, 100, 100));
         HPEN oldPen = (HPEN)SelectObject(hdc, rangePen);
         HBRUSH oldBrush = (HBRUSH)SelectObject(hdc, GetStockObject(NULL_BRUSH));
         
-        int screenX = (int)(hero_->GetPosition().x - cameraOffset_.x);
-        int screenY = (int)(hero_->GetPosition().y - cameraOffset_.y);
-        Ellipse(hdc, screenX - ATTACK_RANGE, screenY - ATTACK_RANGE,
-                screenX + ATTACK_RANGE, screenY + ATTACK_RANGE);
+        // 以英雄中心畫出武器的判定範圍
+        const WeaponStats& weapon = hero.GetWeapon();
+        Vector2D heroPos = hero.GetInterpolatedPosition(interpolation_);
+        int centerX = (int)(heroPos.x - cameraOffset_.x) + hero.GetSize() / 2;
+        int centerY = (int)(heroPos.y - cameraOffset_.y) + hero.GetSize() / 2;
+        int range = (int)weapon.range;
+        float facingDegrees = 0;
+        switch (hero.GetFacing()) {
+            case Direction::Up:    facingDegrees = 90; break;
+            case Direction::Left:  facingDegrees = 180; break;
+            case Direction::Down:  facingDegrees = 270; break;
+            default:               break;
+        }
+        
+        if (weapon.hitShape == HitShape::Line) {
+            float radians = facingDegrees * 3.14159265f / 180.0f;
+            int dx = (int)(std::cos(radians) * range);
+            int dy = -(int)(std::sin(radians) * range);
+            int halfWidth = (int)(weapon.lineWidth * 0.5f);
+            Rectangle(hdc, std::min(centerX, centerX + dx) - halfWidth, std::min(centerY, centerY + dy) - halfWidth,
+                      std::max(centerX, centerX + dx) + halfWidth, std::max(centerY, centerY + dy) + halfWidth);
+        } else if (weapon.hitShape == HitShape::Arc && weapon.arcDegrees < 360.0f) {
+            // Pie 由第一條半徑逆時針畫到第二條
+            float from = (facingDegrees - weapon.arcDegrees * 0.5f) * 3.14159265f / 180.0f;
+            float to = (facingDegrees + weapon.arcDegrees * 0.5f) * 3.14159265f / 180.0f;
+            Pie(hdc, centerX - range, centerY - range, centerX + range, centerY + range,
+                centerX + (int)(std::cos(from) * range), centerY - (int)(std::sin(from) * range),
+                centerX + (int)(std::cos(to) * range), centerY - (int)(std::sin(to) * range));
+        } else {
+            Ellipse(hdc, centerX - range, centerY - range, centerX + range, centerY + range);
+        }
         
         SelectObject(hdc, oldPen);
         SelectObject(hdc, oldBrush);
-        DeleteObject(rangePen);
     }
     
     DrawMinimap(hdc);
@@ -378,222 +459,377 @@ void Game::DrawGame(HDC hdc) {
     DrawHUD(hdc);
 }
 
-void Game::DrawBackground(HDC hdc) {
-    HBRUSH grass1 = CreateSolidBrush(RGB(50, 120, 50));
-    HBRUSH grass2 = CreateSolidBrush(RGB(45, 110, 45));
-    
-    int startTileX = (int)(cameraOffset_.x / TILE_SIZE);
-    int startTileY = (int)(cameraOffset_.y / TILE_SIZE);
-    int endTileX = startTileX + (WINDOW_WIDTH / TILE_SIZE) + 2;
-    int endTileY = startTileY + (WINDOW_HEIGHT / TILE_SIZE) + 2;
-    
-    for (int ty = startTileY; ty < endTileY; ty++) {
-        for (int tx = startTileX; tx < endTileX; tx++) {
-            int screenX = tx * TILE_SIZE - (int)cameraOffset_.x;
-            int screenY = ty * TILE_SIZE - (int)cameraOffset_.y;
-            
-            RECT tileRect = { screenX, screenY, screenX + TILE_SIZE, screenY + TILE_SIZE };
-            FillRect(hdc, &tileRect, ((tx + ty) % 2 == 0) ? grass1 : grass2);
-        }
+void Game::DrawEntities(HDC hdc) {
+    ProfileScope scope(&profiler_, ProfileZone::Entities);
+    
+    // 只繪製視野內（含邊界外一圈）的怪獸；依 ID 排序以維持固定的繪製順序
+    visibleMonsters_.clear();
+    simulation_.GetMonsterGrid().QueryRect(
+        cameraOffset_.x - CULL_MARGIN, cameraOffset_.y - CULL_MARGIN,
+        cameraOffset_.x + bufferWidth_ + CULL_MARGIN, cameraOffset_.y + bufferHeight_ + CULL_MARGIN,
+        visibleMonsters_);
+    std::sort(visibleMonsters_.begin(), visibleMonsters_.end());
+    
+    MonsterPool& monsters = simulation_.GetMonsters();
+    for (int id : visibleMonsters_) {
+        Monster monster = monsters.Get(id);
+        entityRenderer_.DrawMonster(hdc, monster, cameraOffset_);
+        entityRenderer_.DrawMonsterStatus(hdc, monster, cameraOffset_);
     }
+    drawnCount_ = (int)visibleMonsters_.size();
+    culledCount_ = monsters.GetAliveCount() - drawnCount_;
     
-    DeleteObject(grass1);
-    DeleteObject(grass2);
+    const Hero& hero = simulation_.GetHero();
+    if (hero.IsAlive()) {
+        entityRenderer_.DrawHero(hdc, hero, cameraOffset_);
+        entityRenderer_.DrawHeroStatus(hdc, hero, cameraOffset_);
+    }
+}
+
+void Game::DrawWorldSoftware(HDC hdc) {
+    // 先讓排入佇列的 GDI 繪圖完成，再由 CPU 直接寫入同一塊像素
+    GdiFlush();
     
-    HPEN borderPen = CreatePen(PS_SOLID, 3, RGB(100, 50, 0));
-    HPEN oldPen = (HPEN)SelectObject(hdc, borderPen);
-    HBRUSH oldBrush = (HBRUSH)SelectObject(hdc, GetStockObject(NULL_BRUSH));
+    {
+        ProfileScope scope(&profiler_, ProfileZone::Background);
+        softwareRenderer_.DrawBackground(frameBuffer_, cameraOffset_);
+    }
     
-    RECT mapRect = {
-        -(int)cameraOffset_.x,
-        -(int)cameraOffset_.y,
-        MAP_WIDTH - (int)cameraOffset_.x,
-        MAP_HEIGHT - (int)cameraOffset_.y
-    };
-    Rectangle(hdc, mapRect.left, mapRect.top, mapRect.right, mapRect.bottom);
+    ProfileScope scope(&profiler_, ProfileZone::Entities);
+    const Hero& hero = simulation_.GetHero();
+    softwareRenderer_.DrawMonsters(frameBuffer_, simulation_, cameraOffset_, interpolation_);
+    if (hero.IsAlive()) {
+        softwareRenderer_.DrawHero(frameBuffer_, hero, cameraOffset_, interpolation_);
+    }
     
-    SelectObject(hdc, oldPen);
-    SelectObject(hdc, oldBrush);
-    DeleteObject(borderPen);
+    // 角色與血條已在像素緩衝區中，名牌文字仍交給 GDI
+    MonsterPool& monsters = simulation_.GetMonsters();
+    const std::vector<int>& visible = softwareRenderer_.GetVisibleMonsters();
+    for (int id : visible) {
+        entityRenderer_.DrawMonsterStatus(hdc, monsters.Get(id), cameraOffset_);
+    }
+    if (hero.IsAlive()) {
+        entityRenderer_.DrawHeroStatus(hdc, hero, cameraOffset_);
+    }
+    
+    drawnCount_ = (int)visible.size();
+    culledCount_ = softwareRenderer_.GetCulledCount();
+}
+
+void Game::DrawBackground(HDC hdc) {
+    ProfileScope scope(&profiler_, ProfileZone::Background);
+    backgroundLayer_.Draw(hdc, cameraOffset_, bufferWidth_, bufferHeight_);
 }
 
 void Game::DrawMinimap(HDC hdc) {
-    int mapWidth = 150;
-    int mapHeight = 112;
-    int mapX = WINDOW_WIDTH - mapWidth - 10;
+    ProfileScope scope(&profiler_, ProfileZone::Minimap);
+    
+    int mapX = WINDOW_WIDTH - MINIMAP_WIDTH - 10;
     int mapY = 10;
-    float scaleX = (float)mapWidth / MAP_WIDTH;
-    float scaleY = (float)mapHeight / MAP_HEIGHT;
     
-    HBRUSH bgBrush = CreateSolidBrush(RGB(30, 30, 30));
-    RECT bgRect = { mapX - 2, mapY - 2, mapX + mapWidth + 2, mapY + mapHeight + 2 };
+    HBRUSH bgBrush = gdiCache_.GetBrush(RGB(30, 30, 30));
+    RECT bgRect = { mapX - 2, mapY - 2, mapX + MINIMAP_WIDTH + 2, mapY + MINIMAP_HEIGHT + 2 };
     FillRect(hdc, &bgRect, bgBrush);
-    DeleteObject(bgBrush);
-    
-    HBRUSH mapBrush = CreateSolidBrush(RGB(50, 80, 50));
-    RECT mapRect = { mapX, mapY, mapX + mapWidth, mapY + mapHeight };
-    FillRect(hdc, &mapRect, mapBrush);
-    DeleteObject(mapBrush);
     
-    for (const auto& monster : monsters_) {
-        if (!monster->IsAlive()) continue;
-        
-        int dotX = mapX + (int)(monster->GetPosition().x * scaleX);
-        int dotY = mapY + (int)(monster->GetPosition().y * scaleY);
-        
-        HBRUSH dotBrush = CreateSolidBrush(RGB(255, 0, 0));
-        RECT dotRect = { dotX - 2, dotY - 2, dotX + 2, dotY + 2 };
-        FillRect(hdc, &dotRect, dotBrush);
-        DeleteObject(dotBrush);
+    // 怪獸點由圖層降頻重畫；寫入像素前先讓排入佇列的 GDI 繪圖完成
+    if (minimapDC_) {
+        GdiFlush();
+        minimap_.Update(simulation_.GetMonsters());
+        BitBlt(hdc, mapX, mapY, MINIMAP_WIDTH, MINIMAP_HEIGHT, minimapDC_, 0, 0, SRCCOPY);
     }
     
-    int heroX = mapX + (int)(hero_->GetPosition().x * scaleX);
-    int heroY = mapY + (int)(hero_->GetPosition().y * scaleY);
+    // 英雄與視野框每幀移動，直接畫在圖層上方；英雄位置與世界畫面一樣取內插後的位置
+    Vector2D heroPos = simulation_.GetHero().GetInterpolatedPosition(interpolation_);
+    int heroX = mapX + minimap_.ToMapX(heroPos.x);
+    int heroY = mapY + minimap_.ToMapY(heroPos.y);
     
-    HBRUSH heroBrush = CreateSolidBrush(RGB(0, 150, 255));
+    HBRUSH heroBrush = gdiCache_.GetBrush(RGB(0, 150, 255));
+    HBRUSH oldBrush = (HBRUSH)SelectObject(hdc, heroBrush);
     Ellipse(hdc, heroX - 4, heroY - 4, heroX + 4, heroY + 4);
-    DeleteObject(heroBrush);
     
-    HPEN viewPen = CreatePen(PS_SOLID, 1, RGB(255, 255, 255));
+    HPEN viewPen = gdiCache_.GetPen(PS_SOLID, 1, RGB(255, 255, 255));
     HPEN oldPen = (HPEN)SelectObject(hdc, viewPen);
-    HBRUSH oldBrush = (HBRUSH)SelectObject(hdc, GetStockObject(NULL_BRUSH));
+    SelectObject(hdc, GetStockObject(NULL_BRUSH));
     
-    int viewX = mapX + (int)(cameraOffset_.x * scaleX);
-    int viewY = mapY + (int)(cameraOffset_.y * scaleY);
-    int viewW = (int)(WINDOW_WIDTH * scaleX);
-    int viewH = (int)(WINDOW_HEIGHT * scaleY);
+    int viewX = mapX + minimap_.ToMapX(cameraOffset_.x);
+    int viewY = mapY + minimap_.ToMapY(cameraOffset_.y);
+    int viewW = minimap_.ToMapX((float)WINDOW_WIDTH);
+    int viewH = minimap_.ToMapY((float)WINDOW_HEIGHT);
     Rectangle(hdc, viewX, viewY, viewX + viewW, viewY + viewH);
     
     SelectObject(hdc, oldPen);
     SelectObject(hdc, oldBrush);
-    DeleteObject(viewPen);
 }
 
 void Game::DrawHUD(HDC hdc) {
+    ProfileScope scope(&profiler_, ProfileZone::HUD);
+    
     SetBkMode(hdc, TRANSPARENT);
     SetTextAlign(hdc, TA_LEFT);
     
-    HFONT hudFont = CreateFont(18, 0, 0, 0, FW_BOLD, FALSE, FALSE, FALSE,
-                                DEFAULT_CHARSET, OUT_OUTLINE_PRECIS, CLIP_DEFAULT_PRECIS,
-                                CLEARTYPE_QUALITY, DEFAULT_PITCH, L"Arial");
+    HFONT hudFont = gdiCache_.GetFont(18, FW_BOLD);
     HFONT oldFont = (HFONT)SelectObject(hdc, hudFont);
     
+    const Hero& hero = simulation_.GetHero();
     int y = 10;
     const int lineHeight = 22;
+    int line = 0;
+    // 幾乎每幀都變的統計行直接 TextOut：經過文字快取每次都是未命中（重新點陣化並淘汰穩定的字串），
+    // 比直接繪製更慢；只有不常變的行才使用標籤與快取
+    wchar_t text[128];
     
     SetTextColor(hdc, RGB(255, 215, 0));
-    wchar_t text[64];
-    swprintf_s(text, L"Lv. %d", hero_->GetLevel());
-    TextOut(hdc, 10, y, text, (int)wcslen(text));
+    DrawLabel(hdc, 10, y, hudLabels_[line++], L"Lv. %d", hero.GetLevel());
     y += lineHeight;
     
     SetTextColor(hdc, RGB(100, 255, 100));
-    swprintf_s(text, L"HP: %d / %d", hero_->GetCurrentHp(), hero_->GetMaxHp());
-    TextOut(hdc, 10, y, text, (int)wcslen(text));
+    DrawLabel(hdc, 10, y, hudLabels_[line++], L"HP: %d / %d", hero.GetCurrentHp(), hero.GetMaxHp());
     y += lineHeight;
     
     SetTextColor(hdc, RGB(255, 150, 100));
-    swprintf_s(text, L"ATK: %d + %d", hero_->GetAttack(), hero_->GetWeapon().damage);
-    TextOut(hdc, 10, y, text, (int)wcslen(text));
+    DrawLabel(hdc, 10, y, hudLabels_[line++], L"ATK: %d + %d", hero.GetAttack(), hero.GetWeapon().damage);
     y += lineHeight;
     
     SetTextColor(hdc, RGB(200, 200, 200));
-    swprintf_s(text, L"武器: %s", hero_->GetWeapon().name.c_str());
-    TextOut(hdc, 10, y, text, (int)wcslen(text));
+    DrawLabel(hdc, 10, y, hudLabels_[line++], L"武器: %.40s", hero.GetWeapon().name.c_str());
     y += lineHeight;
     
     SetTextColor(hdc, RGB(255, 100, 100));
-    swprintf_s(text, L"擊殺: %d", hero_->GetKills());
+    DrawLabel(hdc, 10, y, hudLabels_[line++], L"擊殺: %d", hero.GetKills());
+    y += lineHeight;
+    
+    // 族群統計由怪獸池在生成與死亡時增量維護，不需每幀掃過怪獸
+    const MonsterPopulation& population = simulation_.GetMonsters().GetPopulation();
+    SetTextColor(hdc, RGB(255, 200, 100));
+    DrawLabel(hdc, 10, y, hudLabels_[line++], L"剩餘怪獸: %d | 波次: %d / %d | 剩餘經驗: %d",
+              population.alive, simulation_.GetWave(), WAVE_COUNT, population.remainingExperience);
+    y += lineHeight;
+    
+    TextLabel& levelsLabel = hudLabels_[line++];
+    if (levelsLabel.Changed(population.levelCounts, MAX_MONSTER_LEVEL + 1)) {
+        wchar_t* text = levelsLabel.GetBuffer();
+        int length = swprintf_s(text, TextLabel::MAX_LENGTH, L"等級分布:");
+        for (int level = 1; level <= MAX_MONSTER_LEVEL; level++) {
+            if (population.levelCounts[level] == 0) continue;
+            length += swprintf_s(text + length, TextLabel::MAX_LENGTH - length, L" Lv%d×%d", level, population.levelCounts[level]);
+        }
+        levelsLabel.SetLength(length);
+    }
+    textCache_.Draw(hdc, 10, y, levelsLabel.GetText(), levelsLabel.GetLength());
+    y += lineHeight;
+    
+    SetTextColor(hdc, RGB(255, 150, 150));
+    DrawLabel(hdc, 10, y, hudLabels_[line++], L"輸出: %d | 承受: %d", damageDealt_, damageTaken_);
+    y += lineHeight;
+    
+    SetTextColor(hdc, RGB(100, 100, 100));
+    DrawLabel(hdc, 10, y, hudLabels_[line++], L"FPS: %d | 種子: %llu", fps_, (unsigned long long)simulation_.GetSeed());
+    y += lineHeight;
+    
+    swprintf_s(text, L"GDI 快取: 命中 %llu / 未命中 %llu",
+               (unsigned long long)gdiCache_.GetHits(), (unsigned long long)gdiCache_.GetMisses());
     TextOut(hdc, 10, y, text, (int)wcslen(text));
     y += lineHeight;
     
-    int aliveMonsters = 0;
-    for (const auto& m : monsters_) {
-        if (m->IsAlive()) aliveMonsters++;
+    swprintf_s(text, L"角色繪製: %.2f ms (%s, F2 切換)",
+               profiler_.GetZoneStats(ProfileZone::Entities).avgMs,
+               entityRenderer_.IsUsingSprites() ? L"圖集" : L"GDI");
+    TextOut(hdc, 10, y, text, (int)wcslen(text));
+    y += lineHeight;
+    
+    DrawLabel(hdc, 10, y, hudLabels_[line++], L"圖集建立: %.2f ms", entityRenderer_.GetSpriteBuildMs());
+    y += lineHeight;
+    
+    if (backend_ == RenderBackend::Software) {
+        DrawLabel(hdc, 10, y, hudLabels_[line++], L"繪製後端: 軟體 (%hs) | F5 切換", GetSimdLevelName(frameBuffer_.GetSimdLevel()));
+    } else {
+        DrawLabel(hdc, 10, y, hudLabels_[line++], L"繪製後端: GDI | F5 切換");
     }
-    SetTextColor(hdc, RGB(255, 200, 100));
-    swprintf_s(text, L"剩餘怪獸: %d", aliveMonsters);
+    y += lineHeight;
+    
+    swprintf_s(text, L"怪獸繪製: %d / 略過: %d", drawnCount_, culledCount_);
     TextOut(hdc, 10, y, text, (int)wcslen(text));
     y += lineHeight;
     
-    SetTextColor(hdc, RGB(100, 100, 100));
-    swprintf_s(text, L"FPS: %d", fps_);
+    const MonsterLodStats& lod = simulation_.GetMonsters().GetLodStats();
+    swprintf_s(text, L"怪獸更新: 近 %d / 中 %d / 遠 %d | 本步 %d",
+               lod.nearCount, lod.midCount, lod.farCount, lod.updated);
+    TextOut(hdc, 10, y, text, (int)wcslen(text));
+    y += lineHeight;
+    
+    const CollisionStats& collision = simulation_.GetCollisionStats();
+    swprintf_s(text, L"碰撞: %d 對 / 測試 %d | 處理 %d / %d | %.2f + %.2f + %.2f ms",
+               collision.contacts, collision.candidates, collision.resolved, collision.monsters,
+               collision.broadMs, collision.narrowMs, collision.applyMs);
+    TextOut(hdc, 10, y, text, (int)wcslen(text));
+    y += lineHeight;
+    
+    const CombatStats& combat = simulation_.GetCombatStats();
+    swprintf_s(text, L"攻擊: 命中 %d / 候選 %d | 擊殺 %d",
+               combat.targets, combat.candidates, combat.kills);
     TextOut(hdc, 10, y, text, (int)wcslen(text));
+    y += lineHeight;
+    
+    swprintf_s(text, L"小地圖: 重畫 %d 次 (%.2f ms) | 每 %d 幀, F6 切換",
+               minimap_.GetRedrawCount(), minimap_.GetLastRedrawMs(), minimap_.GetInterval());
+    TextOut(hdc, 10, y, text, (int)wcslen(text));
+    y += lineHeight;
+    
+    const EventBus& events = simulation_.GetEvents();
+    swprintf_s(text, L"事件: 本幀 %d | 累計 %u | 捨棄 %u",
+               eventsThisFrame_, events.GetPublished(), events.GetDropped());
+    TextOut(hdc, 10, y, text, (int)wcslen(text));
+    y += lineHeight;
+    
+    const wchar_t* sourceNames[] = { L"內建", L"文字", L"快取" };
+    DrawLabel(hdc, 10, y, hudLabels_[line++], L"內容載入: %.2f ms (%s, %zu bytes)", content_.GetLoadMs(),
+              sourceNames[(int)content_.GetSource()], content_.GetImageSize());
     
     SetTextAlign(hdc, TA_CENTER);
+    if (levelUpTimer_ > 0) {
+        SelectObject(hdc, gdiCache_.GetFont(36, FW_BOLD));
+        SetTextColor(hdc, RGB(255, 215, 0));
+        DrawLabel(hdc, WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2 - 160, hudLabels_[line++], L"升級！ Lv. %d", levelUpLevel_);
+    }
+    
     SetTextColor(hdc, RGB(150, 150, 150));
-    HFONT tipFont = CreateFont(14, 0, 0, 0, FW_NORMAL, FALSE, FALSE, FALSE,
-                                DEFAULT_CHARSET, OUT_OUTLINE_PRECIS, CLIP_DEFAULT_PRECIS,
-                                CLEARTYPE_QUALITY, DEFAULT_PITCH, L"Arial");
+    HFONT tipFont = gdiCache_.GetFont(14, FW_NORMAL);
     SelectObject(hdc, tipFont);
-    TextOut(hdc, WINDOW_WIDTH / 2, WINDOW_HEIGHT - 25, 
-            L"方向鍵：移動 | A：攻擊 | ESC：退出", 19);
+    textCache_.Draw(hdc, WINDOW_WIDTH / 2, WINDOW_HEIGHT - 25, 
+                    L"方向鍵：移動 | A：攻擊 | ESC：退出", 19);
     
     SelectObject(hdc, oldFont);
-    DeleteObject(hudFont);
-    DeleteObject(tipFont);
 }
 
-void Game::DrawGameOver(HDC hdc) {
-    HBRUSH overlayBrush = CreateSolidBrush(RGB(0, 0, 0));
-    RECT overlayRect = { 0, 0, WINDOW_WIDTH, WINDOW_HEIGHT };
+void Game::DrawProfilerOverlay(HDC hdc) {
+    const int panelWidth = 320;
+    const int panelX = WINDOW_WIDTH - panelWidth - 10;
+    const int panelY = 135;
+    const int lineHeight = 16;
+    const int graphHeight = 64;
+    const float msToPixels = 3.0f;                  // 圖表每毫秒的高度
+    const double frameBudgetMs = 1000.0 / 60.0;
+    
+    int textHeight = lineHeight * (Profiler::ZONE_COUNT + 4);
+    HBRUSH panelBrush = gdiCache_.GetBrush(RGB(20, 20, 25));
+    RECT panelRect = { panelX, panelY, panelX + panelWidth,
+                       panelY + textHeight + graphHeight + lineHeight + 16 };
+    FillRect(hdc, &panelRect, panelBrush);
     
+    SetBkMode(hdc, TRANSPARENT);
+    SetTextAlign(hdc, TA_LEFT);
+    HFONT font = gdiCache_.GetFont(14, FW_NORMAL, L"Consolas");
+    HFONT oldFont = (HFONT)SelectObject(hdc, font);
+    
+    int x = panelX + 8;
+    int y = panelY + 4;
+    wchar_t text[96];
+    
+    SetTextColor(hdc, RGB(255, 215, 0));
+    swprintf_s(text, L"%-14s %7s %7s %7s", L"zone (ms)", L"min", L"avg", L"p99");
+    TextOut(hdc, x, y, text, (int)wcslen(text));
+    y += lineHeight;
+    
+    SetTextColor(hdc, RGB(220, 220, 220));
+    for (int i = 0; i < Profiler::ZONE_COUNT; i++) {
+        ProfileZone zone = (ProfileZone)i;
+        ZoneStats stats = profiler_.GetZoneStats(zone);
+        swprintf_s(text, L"%-14hs %7.3f %7.3f %7.3f",
+                   Profiler::GetZoneName(zone), stats.minMs, stats.avgMs, stats.p99Ms);
+        TextOut(hdc, x, y, text, (int)wcslen(text));
+        y += lineHeight;
+    }
+    
+    ZoneStats frame = profiler_.GetFrameStats();
+    SetTextColor(hdc, RGB(100, 255, 100));
+    swprintf_s(text, L"%-14s %7.3f %7.3f %7.3f", L"Frame", frame.minMs, frame.avgMs, frame.p99Ms);
+    TextOut(hdc, x, y, text, (int)wcslen(text));
+    y += lineHeight;
+    
+    // 文字快取：本幀命中率（不含分析面板本身，面板數字每幀都變，直接 TextOut）與累計命中率
+    const TextCacheFrameStats& textFrame = textCache_.GetFrameStats();
+    const TextCacheIndex& textIndex = textCache_.GetIndex();
+    int textLookups = textFrame.hits + textFrame.rasterized;
+    SetTextColor(hdc, RGB(120, 200, 255));
+    swprintf_s(text, L"%-14s %6.1f%% hit  total %5.1f%%", L"Text cache",
+               textLookups > 0 ? 100.0 * textFrame.hits / textLookups : 0.0, 100.0 * textIndex.GetHitRate());
+    TextOut(hdc, x, y, text, (int)wcslen(text));
+    y += lineHeight;
+    swprintf_s(text, L"  raster %d  direct %d  slots %d/%d  evict %llu",
+               textFrame.rasterized, textFrame.fallbacks, textIndex.GetSize(), textIndex.GetCapacity(),
+               (unsigned long long)textIndex.GetEvictions());
+    TextOut(hdc, x, y, text, (int)wcslen(text));
+    y += lineHeight + 4;
+    
+    // 幀時間圖：最新的一幀在最右側，超出預算的幀以紅色顯示
+    int graphBottom = y + graphHeight;
+    int graphRight = x + Profiler::FRAME_HISTORY;
+    HBRUSH okBrush = gdiCache_.GetBrush(RGB(0, 180, 0));
+    HBRUSH overBrush = gdiCache_.GetBrush(RGB(220, 50, 50));
+    for (int i = 0; i < profiler_.GetHistorySize(); i++) {
+        double frameMs = profiler_.GetFrameMs(i);
+        int barHeight = std::min(graphHeight, (int)(frameMs * msToPixels));
+        RECT bar = { graphRight - i - 1, graphBottom - barHeight, graphRight - i, graphBottom };
+        FillRect(hdc, &bar, frameMs > frameBudgetMs ? overBrush : okBrush);
+    }
+    
+    int budgetY = graphBottom - (int)(frameBudgetMs * msToPixels);
+    RECT budgetLine = { x, budgetY, graphRight, budgetY + 1 };
+    FillRect(hdc, &budgetLine, gdiCache_.GetBrush(RGB(255, 215, 0)));
+    y = graphBottom + 4;
+    
+    SetTextColor(hdc, RGB(150, 150, 150));
+    swprintf_s(text, L"F3 關閉 | F4 輸出 trace  %s", traceMessage_ ? traceMessage_ : L"");
+    TextOut(hdc, x, y, text, (int)wcslen(text));
+    
+    SelectObject(hdc, oldFont);
+}
+
+void Game::DrawGameOver(HDC hdc) {
     SetBkMode(hdc, TRANSPARENT);
     SetTextAlign(hdc, TA_CENTER);
     
-    HFONT titleFont = CreateFont(72, 0, 0, 0, FW_BOLD, FALSE, FALSE, FALSE,
-                                  DEFAULT_CHARSET, OUT_OUTLINE_PRECIS, CLIP_DEFAULT_PRECIS,
-                                  CLEARTYPE_QUALITY, DEFAULT_PITCH, L"Arial");
+    HFONT titleFont = gdiCache_.GetFont(72, FW_BOLD);
     HFONT oldFont = (HFONT)SelectObject(hdc, titleFont);
     
     SetTextColor(hdc, RGB(200, 0, 0));
     TextOut(hdc, WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2 - 50, L"GAME OVER", 9);
     
-    HFONT subFont = CreateFont(24, 0, 0, 0, FW_NORMAL, FALSE, FALSE, FALSE,
-                                DEFAULT_CHARSET, OUT_OUTLINE_PRECIS, CLIP_DEFAULT_PRECIS,
-                                CLEARTYPE_QUALITY, DEFAULT_PITCH, L"Arial");
+    HFONT subFont = gdiCache_.GetFont(24, FW_NORMAL);
     SelectObject(hdc, subFont);
     
+    const Hero& hero = simulation_.GetHero();
     SetTextColor(hdc, RGB(255, 255, 255));
     wchar_t text[64];
-    swprintf_s(text, L"最終等級: %d | 擊殺數: %d", hero_->GetLevel(), hero_->GetKills());
+    swprintf_s(text, L"最終等級: %d | 擊殺數: %d", hero.GetLevel(), hero.GetKills());
     TextOut(hdc, WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2 + 30, text, (int)wcslen(text));
     
     SetTextColor(hdc, RGB(150, 150, 150));
     TextOut(hdc, WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2 + 70, L"按 SPACE 或 ENTER 重新開始", 16);
     
     SelectObject(hdc, oldFont);
-    DeleteObject(titleFont);
-    DeleteObject(subFont);
-    DeleteObject(overlayBrush);
 }
 
 void Game::DrawVictory(HDC hdc) {
     SetBkMode(hdc, TRANSPARENT);
     SetTextAlign(hdc, TA_CENTER);
     
-    HFONT titleFont = CreateFont(72, 0, 0, 0, FW_BOLD, FALSE, FALSE, FALSE,
-                                  DEFAULT_CHARSET, OUT_OUTLINE_PRECIS, CLIP_DEFAULT_PRECIS,
-                                  CLEARTYPE_QUALITY, DEFAULT_PITCH, L"Arial");
+    HFONT titleFont = gdiCache_.GetFont(72, FW_BOLD);
     HFONT oldFont = (HFONT)SelectObject(hdc, titleFont);
     
     SetTextColor(hdc, RGB(255, 215, 0));
     TextOut(hdc, WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2 - 50, L"VICTORY!", 8);
     
-    HFONT subFont = CreateFont(24, 0, 0, 0, FW_NORMAL, FALSE, FALSE, FALSE,
-                                DEFAULT_CHARSET, OUT_OUTLINE_PRECIS, CLIP_DEFAULT_PRECIS,
-                                CLEARTYPE_QUALITY, DEFAULT_PITCH, L"Arial");
+    HFONT subFont = gdiCache_.GetFont(24, FW_NORMAL);
     SelectObject(hdc, subFont);
     
     SetTextColor(hdc, RGB(255, 255, 255));
     wchar_t text[64];
-    swprintf_s(text, L"最終等級: %d | 消滅所有怪獸!", hero_->GetLevel());
+    swprintf_s(text, L"最終等級: %d | 消滅所有怪獸!", simulation_.GetHero().GetLevel());
     TextOut(hdc, WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2 + 30, text, (int)wcslen(text));
     
     SetTextColor(hdc, RGB(150, 150, 150));
     TextOut(hdc, WINDOW_WIDTH / 2, WINDOW_HEIGHT / 2 + 70, L"按 SPACE 或 ENTER 再次挑戰", 15);
     
     SelectObject(hdc, oldFont);
-    DeleteObject(titleFont);
-    DeleteObject(subFont);
 }
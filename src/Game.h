@@ -1,28 +1,93 @@
 #pragma once
-#include "Character.h"
+#include <windows.h>
+#include "BackgroundLayer.h"
+#include "Clock.h"
+#include "EntityRenderer.h"
+#include "GdiCache.h"
+#include "InputRecording.h"
+#include "MinimapLayer.h"
+#include "Profiler.h"
+#include "Rasterizer.h"
+#include "Simulation.h"
+#include "SoftwareRenderer.h"
+#include "TextCache.h"
+#include "TextLabel.h"
+#include <string>
 #include <vector>
-#include <memory>
+
+// ============================================================================
+// 繪製後端
+// ============================================================================
+enum class RenderBackend {
+    Gdi,         // 每個圖元一次 GDI 呼叫
+    Software     // 世界畫面直接寫入 DIB section 的像素，文字仍由 GDI 繪製
+};
 
 // ============================================================================
 // 遊戲主類別
 // ============================================================================
 class Game {
 private:
-    // 遊戲物件
-    std::unique_ptr<Hero> hero_;
-    std::vector<std::unique_ptr<Monster>> monsters_;
+    // 模擬核心（時鐘隨固定步長推進，與實際幀率無關）
+    ManualClock clock_;
+    ContentDatabase content_;            // 武器與怪獸等級表
+    std::wstring contentPath_;           // 內容原始檔（--content）
+    static constexpr const char* CONTENT_CACHE = "herowar_content.bin";
+    JobSystem jobSystem_;                // 怪獸平行更新
+    Simulation simulation_;
+    
+    // 固定步長迴圈
+    static constexpr double MAX_FRAME_TIME = 0.25;   // 單幀最多補跑的秒數
+    double accumulator_;                 // 尚未模擬的累積時間（秒）
+    float interpolation_;                // 繪製內插係數
     
-    // 遊戲狀態
-    GameState gameState_;
+    // 畫面狀態
     Vector2D cameraOffset_;
-    DWORD lastUpdateTime_;
+    GdiCache gdiCache_;                  // 跨幀重用的筆刷、畫筆與字型
+    TextCache textCache_;                // 預先繪製的常用字串（HUD 與頭上文字）
+    EntityRenderer entityRenderer_;
+    BackgroundLayer backgroundLayer_;    // 預先繪製的地圖背景
+    RenderBackend backend_;              // 目前的繪製後端（F5 切換）
+    SoftwareRenderer softwareRenderer_;  // 軟體繪圖後端
+    Rasterizer frameBuffer_;             // 掛在 DIB section 上的像素緩衝區
+    
+    // 小地圖（怪獸點畫在自己的 DIB section，降頻重畫後一次 BitBlt 貼上）
+    static constexpr int MINIMAP_WIDTH = 150;
+    static constexpr int MINIMAP_HEIGHT = 112;
+    MinimapLayer minimap_;
+    HDC minimapDC_;
+    HBITMAP minimapBitmap_;
+    HBITMAP minimapOldBitmap_;
+    
+    // 視野裁切
+    // 邊界需涵蓋精靈格子（錨點到格子邊緣）與頭上的等級文字、血條
+    static constexpr int CULL_MARGIN = 64;
+    std::vector<int> visibleMonsters_;   // 本幀視野內的怪獸 ID
+    int drawnCount_;                     // 本幀繪製的怪獸數
+    int culledCount_;                    // 本幀略過的存活怪獸數
+    
+    // 事件處理（模擬發布，每幀 Update 結尾整批取出）
+    static constexpr float LEVEL_UP_BANNER_SECONDS = 2.0f;
+    std::vector<GameEvent> eventBatch_;  // 取出事件的暫存（容量與匯流排相同）
+    int eventsThisFrame_;                // 本幀處理的事件數
+    float levelUpTimer_;                 // 升級提示剩餘秒數
+    int levelUpLevel_;                   // 升級提示顯示的等級
+    int damageDealt_;                    // 本局英雄造成的傷害
+    int damageTaken_;                    // 本局英雄受到的傷害
+    
+    // HUD 文字（每行一個標籤，數值改變時才重新格式化）
+    static constexpr int HUD_LABEL_COUNT = 24;
+    TextLabel hudLabels_[HUD_LABEL_COUNT];
     
     // 輸入狀態
-    bool keyStates_[256];
+    InputSnapshot input_;
+    InputRecording recording_;           // 每個模擬步的輸入（--record 時啟用）
+    std::wstring recordPath_;            // 錄製檔路徑（空字串表示不錄製）
     
     // 雙緩衝繪圖
     HDC memDC_;
-    HBITMAP memBitmap_;
+    HBITMAP memBitmap_;                  // GDI 後端的相容點陣圖
+    HBITMAP dibBitmap_;                  // 軟體後端的 DIB section（兩者都以一次 BitBlt 輸出）
     HBITMAP oldBitmap_;
     int bufferWidth_;
     int bufferHeight_;
@@ -30,44 +95,63 @@ private:
     // 統計資訊
     int fps_;
     int frameCount_;
-    DWORD fpsTimer_;
+    double fpsTimer_;
+    
+    // 效能分析
+    static constexpr const char* TRACE_FILE = "herowar_trace.json";
+    Profiler profiler_;
+    bool showProfiler_;                  // 是否顯示分析面板（F3）
+    const wchar_t* traceMessage_;        // 最近一次輸出 trace 的結果（F4）
     
 public:
-    Game();
+    Game(uint64_t seed, const std::wstring& contentPath);
     ~Game();
     
     // 初始化
     bool Initialize(HWND hWnd);
-    void InitializeMonsters();
     
-    // 遊戲迴圈
-    void Update();
+    // 遊戲迴圈（frameSeconds 為距上一幀的實際秒數）
+    void Update(double frameSeconds);
     void Render(HDC hdc);
     
+    // 輸入錄製（結束時寫入檔案，供 HeroWarBench replay 重播）
+    void StartRecording(const std::wstring& path);
+    void SaveRecording();
+    
     // 輸入處理
     void HandleKeyDown(WPARAM key);
     void HandleKeyUp(WPARAM key);
-    bool IsKeyPressed(int key) const;
     
-    // 遊戲邏輯
-    void UpdatePlaying(float deltaTime);
-    void CheckAttack();
+    // 畫面邏輯
     void UpdateCamera();
-    void CheckGameOver();
+    void ProcessEvents(double frameSeconds);
     
     // 繪製方法
     void DrawWeaponSelect(HDC hdc);
+    void DrawWeaponIcon(HDC hdc, const WeaponStats& weapon, int x, int y);
     void DrawGame(HDC hdc);
+    void DrawEntities(HDC hdc);
+    void DrawWorldSoftware(HDC hdc);
     void DrawBackground(HDC hdc);
     void DrawMinimap(HDC hdc);
     void DrawHUD(HDC hdc);
+    void DrawProfilerOverlay(HDC hdc);
     void DrawGameOver(HDC hdc);
     void DrawVictory(HDC hdc);
     
+    // 以標籤格式化（參數沒變時沿用上次的字串）後經文字快取繪製
+    template<typename... Args>
+    void DrawLabel(HDC hdc, int x, int y, TextLabel& label, const wchar_t* format, Args... args) {
+        label.Format(format, args...);
+        textCache_.Draw(hdc, x, y, label.GetText(), label.GetLength());
+    }
+    
     // 工具方法
     void CreateBackBuffer(HWND hWnd);
     void DeleteBackBuffer();
+    void SetBackend(RenderBackend backend);
     
     // 存取方法
-    GameState GetState() const { return gameState_; }
+    GameState GetState() const { return simulation_.GetState(); }
+    const Simulation& GetSimulation() const { return simulation_; }
 };
@@ -0,0 +1,64 @@
+#include "GdiCache.h"
+
+GdiCache::GdiCache()
+    : hits_(0)
+    , misses_(0)
+{
+}
+
+GdiCache::~GdiCache() {
+    Clear();
+}
+
+HBRUSH GdiCache::GetBrush(COLORREF color) {
+    auto it = brushes_.find(color);
+    if (it != brushes_.end()) {
+        hits_++;
+        return it->second;
+    }
+    
+    misses_++;
+    HBRUSH brush = CreateSolidBrush(color);
+    brushes_[color] = brush;
+    return brush;
+}
+
+HPEN GdiCache::GetPen(int style, int width, COLORREF color) {
+    uint64_t key = ((uint64_t)(uint8_t)style << 56) | ((uint64_t)(uint16_t)width << 32) | color;
+    auto it = pens_.find(key);
+    if (it != pens_.end()) {
+        hits_++;
+        return it->second;
+    }
+    
+    misses_++;
+    HPEN pen = CreatePen(style, width, color);
+    pens_[key] = pen;
+    return pen;
+}
+
+HFONT GdiCache::GetFont(int height, int weight, const wchar_t* face) {
+    FontKey key = { height, weight, face };
+    auto it = fonts_.find(key);
+    if (it != fonts_.end()) {
+        hits_++;
+        return it->second;
+    }
+    
+    misses_++;
+    HFONT font = CreateFont(height, 0, 0, 0, weight, FALSE, FALSE, FALSE,
+                            DEFAULT_CHARSET, OUT_OUTLINE_PRECIS, CLIP_DEFAULT_PRECIS,
+                            CLEARTYPE_QUALITY, DEFAULT_PITCH, face);
+    fonts_[key] = font;
+    return font;
+}
+
+void GdiCache::Clear() {
+    for (auto& entry : brushes_) DeleteObject(entry.second);
+    for (auto& entry : pens_) DeleteObject(entry.second);
+    for (auto& entry : fonts_) DeleteObject(entry.second);
+    
+    brushes_.clear();
+    pens_.clear();
+    fonts_.clear();
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <windows.h>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+// ============================================================================
+// GDI 物件快取
+// 筆刷、畫筆、字型依規格建立一次後跨幀重複使用，解構時統一釋放
+// 取得的物件由快取擁有，呼叫端不可 DeleteObject
+// ============================================================================
+class GdiCache {
+private:
+    struct FontKey {
+        int height;
+        int weight;
+        std::wstring face;
+
+        bool operator<(const FontKey& other) const {
+            if (height != other.height) return height < other.height;
+            if (weight != other.weight) return weight < other.weight;
+            return face < other.face;
+        }
+    };
+
+    std::unordered_map<COLORREF, HBRUSH> brushes_;   // 依顏色
+    std::unordered_map<uint64_t, HPEN> pens_;        // 依樣式 / 寬度 / 顏色
+    std::map<FontKey, HFONT> fonts_;                 // 依高度 / 粗細 / 字型名稱
+    uint64_t hits_;                                  // 命中次數
+    uint64_t misses_;                                // 未命中（實際建立）次數
+
+public:
+    GdiCache();
+    ~GdiCache();
+
+    GdiCache(const GdiCache&) = delete;
+    GdiCache& operator=(const GdiCache&) = delete;
+
+    // 取得物件（不存在時建立）
+    HBRUSH GetBrush(COLORREF color);
+    HPEN GetPen(int style, int width, COLORREF color);
+    HFONT GetFont(int height, int weight, const wchar_t* face = L"Arial");
+
+    // 釋放所有物件（物件不可仍被選入任何 DC）
+    void Clear();
+
+    // 統計資訊
+    uint64_t GetHits() const { return hits_; }
+    uint64_t GetMisses() const { return misses_; }
+    int GetObjectCount() const { return (int)(brushes_.size() + pens_.size() + fonts_.size()); }
+};
@@ -0,0 +1,184 @@
+#include "InputRecording.h"
+#include <cstdio>
+
+namespace {
+
+const size_t HEADER_SIZE = 4 + 2 + 2 + 8 + 8 + 4 + 4 + 4;
+
+void WriteLE(std::vector<uint8_t>& out, uint64_t value, int bytes) {
+    for (int i = 0; i < bytes; i++) {
+        out.push_back((uint8_t)(value >> (8 * i)));
+    }
+}
+
+uint64_t ReadLE(const uint8_t* data, int bytes) {
+    uint64_t value = 0;
+    for (int i = 0; i < bytes; i++) {
+        value |= (uint64_t)data[i] << (8 * i);
+    }
+    return value;
+}
+
+void WriteVarint(std::vector<uint8_t>& out, uint32_t value) {
+    while (value >= 0x80) {
+        out.push_back((uint8_t)(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back((uint8_t)value);
+}
+
+}
+
+// ============================================================================
+// 錄製
+// ============================================================================
+InputRecording::InputRecording()
+    : seed_(0)
+    , contentHash_(0)
+    , monsterCount_(0)
+    , tickCount_(0)
+    , lastEventTick_(0)
+{
+}
+
+void InputRecording::Begin(uint64_t seed, int monsterCount, uint64_t contentHash) {
+    seed_ = seed;
+    contentHash_ = contentHash;
+    monsterCount_ = monsterCount;
+    tickCount_ = 0;
+    lastEventTick_ = 0;
+    events_.clear();
+    previous_ = InputSnapshot();
+}
+
+void InputRecording::RecordTick(const InputSnapshot& input) {
+    uint8_t changed[256];
+    int changeCount = 0;
+    for (int key = 0; key < 256; key++) {
+        if (input.keys[key] != previous_.keys[key]) {
+            changed[changeCount++] = (uint8_t)key;
+        }
+    }
+
+    // 單一模擬步最多 255 個變化（一個位元組）；實際上同時變化的按鍵不會這麼多
+    if (changeCount > 0) {
+        if (changeCount > 255) changeCount = 255;
+        WriteVarint(events_, tickCount_ - lastEventTick_);
+        events_.push_back((uint8_t)changeCount);
+        events_.insert(events_.end(), changed, changed + changeCount);
+        for (int i = 0; i < changeCount; i++) {
+            previous_.keys[changed[i]] = input.keys[changed[i]];
+        }
+        lastEventTick_ = tickCount_;
+    }
+
+    tickCount_++;
+}
+
+// ============================================================================
+// 序列化
+// ============================================================================
+std::vector<uint8_t> InputRecording::Serialize() const {
+    std::vector<uint8_t> out;
+    out.reserve(HEADER_SIZE + events_.size());
+    WriteLE(out, MAGIC, 4);
+    WriteLE(out, VERSION, 2);
+    WriteLE(out, 0, 2);
+    WriteLE(out, seed_, 8);
+    WriteLE(out, contentHash_, 8);
+    WriteLE(out, (uint32_t)monsterCount_, 4);
+    WriteLE(out, tickCount_, 4);
+    WriteLE(out, (uint32_t)events_.size(), 4);
+    out.insert(out.end(), events_.begin(), events_.end());
+    return out;
+}
+
+bool InputRecording::Deserialize(const uint8_t* data, size_t size) {
+    if (size < HEADER_SIZE) return false;
+    if (ReadLE(data, 4) != MAGIC || ReadLE(data + 4, 2) != VERSION) return false;
+
+    uint32_t eventBytes = (uint32_t)ReadLE(data + 32, 4);
+    if (size - HEADER_SIZE < eventBytes) return false;
+
+    seed_ = ReadLE(data + 8, 8);
+    contentHash_ = ReadLE(data + 16, 8);
+    monsterCount_ = (int)(int32_t)ReadLE(data + 24, 4);
+    tickCount_ = (uint32_t)ReadLE(data + 28, 4);
+    lastEventTick_ = 0;
+    events_.assign(data + HEADER_SIZE, data + HEADER_SIZE + eventBytes);
+    previous_ = InputSnapshot();
+    return true;
+}
+
+bool InputRecording::Save(const char* path) const {
+    FILE* file = std::fopen(path, "wb");
+    if (!file) return false;
+
+    std::vector<uint8_t> bytes = Serialize();
+    size_t written = std::fwrite(bytes.data(), 1, bytes.size(), file);
+    return std::fclose(file) == 0 && written == bytes.size();
+}
+
+bool InputRecording::Load(const char* path) {
+    FILE* file = std::fopen(path, "rb");
+    if (!file) return false;
+
+    std::vector<uint8_t> bytes;
+    uint8_t buffer[4096];
+    size_t read;
+    while ((read = std::fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        bytes.insert(bytes.end(), buffer, buffer + read);
+    }
+    std::fclose(file);
+
+    return Deserialize(bytes.data(), bytes.size());
+}
+
+// ============================================================================
+// 播放
+// ============================================================================
+InputPlayer::InputPlayer(const InputRecording& recording)
+    : recording_(recording)
+    , cursor_(0)
+    , tick_(0)
+    , nextEventTick_(0)
+{
+    ReadNextEventTick();
+}
+
+void InputPlayer::ReadNextEventTick() {
+    const std::vector<uint8_t>& events = recording_.GetEvents();
+
+    uint32_t delta = 0;
+    int shift = 0;
+    while (cursor_ < events.size() && shift < 32) {
+        uint8_t byte = events[cursor_++];
+        delta |= (uint32_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            nextEventTick_ += delta;
+            return;
+        }
+        shift += 7;
+    }
+
+    // 沒有更多事件
+    nextEventTick_ = UINT32_MAX;
+}
+
+bool InputPlayer::Next(InputSnapshot& out) {
+    if (tick_ >= recording_.GetTickCount()) return false;
+
+    const std::vector<uint8_t>& events = recording_.GetEvents();
+    if (tick_ == nextEventTick_ && cursor_ < events.size()) {
+        int changeCount = events[cursor_++];
+        for (int i = 0; i < changeCount && cursor_ < events.size(); i++) {
+            uint8_t key = events[cursor_++];
+            state_.keys[key] = !state_.keys[key];
+        }
+        ReadNextEventTick();
+    }
+
+    out = state_;
+    tick_++;
+    return true;
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include "Simulation.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ============================================================================
+// 輸入錄製檔
+// 記錄種子、怪獸數量、內容雜湊與每個模擬步的按鍵變化，可在無視窗環境以全速重播
+// 重播前需以相同的內容（ContentDatabase::GetContentHash 相符）設定模擬核心，否則結果會分歧
+//
+// 檔案格式（小端序）：
+//   uint32 magic "HWRP" | uint16 version | uint16 reserved
+//   uint64 seed | uint64 contentHash | int32 monsterCount | uint32 tickCount | uint32 eventBytes
+//   事件：varint 距上一事件的模擬步數 | uint8 變化數 n | n 個切換狀態的按鍵碼
+// ============================================================================
+class InputRecording {
+private:
+    uint64_t seed_;
+    uint64_t contentHash_;               // 錄製時使用的內容（ContentDatabase::GetContentHash）
+    int monsterCount_;
+    uint32_t tickCount_;                 // 已記錄的模擬步數
+    uint32_t lastEventTick_;             // 上一個事件的模擬步
+    std::vector<uint8_t> events_;        // 編碼後的事件
+    InputSnapshot previous_;             // 上一個模擬步的按鍵狀態
+
+public:
+    static constexpr uint32_t MAGIC = 0x50525748;   // "HWRP"
+    static constexpr uint16_t VERSION = 2;
+
+    InputRecording();
+
+    // 錄製：Begin 後每個模擬步呼叫一次 RecordTick
+    void Begin(uint64_t seed, int monsterCount, uint64_t contentHash);
+    void RecordTick(const InputSnapshot& input);
+
+    // 序列化
+    std::vector<uint8_t> Serialize() const;
+    bool Deserialize(const uint8_t* data, size_t size);
+    bool Save(const char* path) const;
+    bool Load(const char* path);
+
+    // 存取方法
+    uint64_t GetSeed() const { return seed_; }
+    uint64_t GetContentHash() const { return contentHash_; }
+    int GetMonsterCount() const { return monsterCount_; }
+    uint32_t GetTickCount() const { return tickCount_; }
+    const std::vector<uint8_t>& GetEvents() const { return events_; }
+};
+
+// ============================================================================
+// 錄製檔播放器：依序還原每個模擬步的輸入快照
+// ============================================================================
+class InputPlayer {
+private:
+    const InputRecording& recording_;
+    size_t cursor_;                      // 事件讀取位置
+    uint32_t tick_;                      // 下一個要還原的模擬步
+    uint32_t nextEventTick_;             // 下一個事件所在的模擬步
+    InputSnapshot state_;
+
+    void ReadNextEventTick();
+
+public:
+    explicit InputPlayer(const InputRecording& recording);
+
+    // 取得下一個模擬步的輸入；錄製結束時回傳 false
+    bool Next(InputSnapshot& out);
+};
@@ -0,0 +1,118 @@
+#include "JobSystem.h"
+#include <algorithm>
+
+JobSystem::JobSystem(int workerCount)
+    : queued_(0)
+    , pending_(0)
+    , stopping_(false)
+{
+    workerCount = std::max(0, workerCount);
+    for (int i = 0; i <= workerCount; i++) {
+        queues_.push_back(std::make_unique<WorkQueue>());
+    }
+    for (int i = 1; i <= workerCount; i++) {
+        workers_.emplace_back(&JobSystem::WorkerLoop, this, i);
+    }
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        stopping_ = true;
+    }
+    wakeCondition_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+int JobSystem::DefaultWorkerCount() {
+    int hardware = (int)std::thread::hardware_concurrency();
+    return std::max(0, hardware - 1);
+}
+
+void JobSystem::ParallelFor(int count, int chunkSize, const RangeFunction& func) {
+    if (count <= 0) return;
+    chunkSize = std::max(1, chunkSize);
+
+    int chunkCount = (count + chunkSize - 1) / chunkSize;
+    if (chunkCount == 1 || workers_.empty()) {
+        for (int chunk = 0; chunk < chunkCount; chunk++) {
+            func(chunk * chunkSize, std::min(count, (chunk + 1) * chunkSize), chunk);
+        }
+        return;
+    }
+
+    // 連續的區塊分給同一個執行緒，讓每條佇列一開始就有相鄰的資料
+    // queued_ 必須在放入工作之前累加：上一批還在 RunOne 迴圈中的執行緒可能立刻取走新工作並遞減，
+    // 若之後才覆寫計數，計數會停在大於 0，所有執行緒在下一批之前都會空轉
+    int threadCount = GetThreadCount();
+    pending_.store(chunkCount);
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        queued_.fetch_add(chunkCount);
+    }
+    for (int chunk = 0; chunk < chunkCount; chunk++) {
+        Job job = { &func, chunk * chunkSize, std::min(count, (chunk + 1) * chunkSize), chunk };
+        WorkQueue& queue = *queues_[(int)((long long)chunk * threadCount / chunkCount)];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.jobs.push_back(job);
+    }
+    wakeCondition_.notify_all();
+
+    // 呼叫端也參與工作，直到所有區塊完成
+    while (pending_.load() > 0) {
+        if (!RunOne(0)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool JobSystem::PopLocal(int index, Job& job) {
+    WorkQueue& queue = *queues_[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.jobs.empty()) return false;
+
+    job = queue.jobs.back();
+    queue.jobs.pop_back();
+    return true;
+}
+
+bool JobSystem::Steal(int index, Job& job) {
+    int threadCount = GetThreadCount();
+    for (int offset = 1; offset < threadCount; offset++) {
+        WorkQueue& queue = *queues_[(index + offset) % threadCount];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.jobs.empty()) continue;
+
+        job = queue.jobs.front();
+        queue.jobs.pop_front();
+        return true;
+    }
+    return false;
+}
+
+bool JobSystem::RunOne(int index) {
+    Job job;
+    if (!PopLocal(index, job) && !Steal(index, job)) {
+        return false;
+    }
+    queued_.fetch_sub(1);
+
+    (*job.func)(job.begin, job.end, job.chunk);
+    pending_.fetch_sub(1);
+    return true;
+}
+
+void JobSystem::WorkerLoop(int index) {
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(wakeMutex_);
+            wakeCondition_.wait(lock, [this] { return stopping_ || queued_.load() > 0; });
+            if (stopping_) return;
+        }
+
+        while (RunOne(index)) {
+        }
+    }
+}
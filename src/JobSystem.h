@@ -0,0 +1,61 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// 工作竊取排程器
+// 每個執行緒（含呼叫端）各有一條工作佇列：自己從尾端取、閒置時從別人的前端偷，
+// 區塊大小不一時也能把核心填滿；ParallelFor 返回時所有區塊都已完成
+// ============================================================================
+class JobSystem {
+public:
+    // 區塊函式：處理 [begin, end)，chunk 為區塊編號（與執行緒無關，可用於決定性的資料分流）
+    typedef std::function<void(int begin, int end, int chunk)> RangeFunction;
+
+    // workerCount 為額外的背景執行緒數；0 表示只在呼叫端執行
+    explicit JobSystem(int workerCount = DefaultWorkerCount());
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // 將 [0, count) 切成 chunkSize 大小的區塊平行執行
+    void ParallelFor(int count, int chunkSize, const RangeFunction& func);
+
+    int GetThreadCount() const { return (int)queues_.size(); }
+
+    // 硬體執行緒數減去呼叫端
+    static int DefaultWorkerCount();
+
+private:
+    struct Job {
+        const RangeFunction* func;
+        int begin;
+        int end;
+        int chunk;
+    };
+
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> queues_;   // [0] 為呼叫端
+    std::vector<std::thread> workers_;
+    std::mutex wakeMutex_;
+    std::condition_variable wakeCondition_;
+    std::atomic<int> queued_;            // 尚未被取走的工作數
+    std::atomic<int> pending_;           // 尚未完成的工作數
+    bool stopping_;
+
+    bool PopLocal(int index, Job& job);
+    bool Steal(int index, Job& job);
+    bool RunOne(int index);
+    void WorkerLoop(int index);
+};
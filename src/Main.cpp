@@ -1,8 +1,16 @@
 #include <windows.h>
+#include "FrameTimer.h"
 #include "Game.h"
+#include <ctime>
+#include <cwchar>
+#include <string>
 
 // 全域變數
 Game* g_pGame = nullptr;
+uint64_t g_seed = 0;
+std::wstring g_recordPath;
+std::wstring g_contentPath;
+bool g_softwareRenderer = false;
 const wchar_t* WINDOW_CLASS = L"HeroWarClass";
 const wchar_t* WINDOW_TITLE = L"Hero War 英雄戰爭";
 
@@ -13,21 +21,17 @@ LRESULT CALLBACK WindowProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lPara
     switch (message) {
         case WM_CREATE:
             // 建立遊戲物件
-            g_pGame = new Game();
+            g_pGame = new Game(g_seed, g_contentPath);
             if (!g_pGame->Initialize(hWnd)) {
                 MessageBox(hWnd, L"遊戲初始化失敗！", L"錯誤", MB_ICONERROR);
                 PostQuitMessage(1);
                 return -1;
             }
-            // 設定計時器（約60FPS）
-            SetTimer(hWnd, 1, 16, NULL);
-            return 0;
-            
-        case WM_TIMER:
-            // 遊戲迴圈
-            if (g_pGame) {
-                g_pGame->Update();
-                InvalidateRect(hWnd, NULL, FALSE);
+            if (g_softwareRenderer) {
+                g_pGame->SetBackend(RenderBackend::Software);
+            }
+            if (!g_recordPath.empty()) {
+                g_pGame->StartRecording(g_recordPath);
             }
             return 0;
             
@@ -45,9 +49,9 @@ LRESULT CALLBACK WindowProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lPara
             if (g_pGame) {
                 g_pGame->HandleKeyDown(wParam);
             }
-            // ESC 鍵退出
+            // ESC 鍵退出：經由 WM_DESTROY 釋放遊戲物件（寫入錄製檔）
             if (wParam == VK_ESCAPE) {
-                PostQuitMessage(0);
+                DestroyWindow(hWnd);
             }
             return 0;
             
@@ -58,7 +62,6 @@ LRESULT CALLBACK WindowProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lPara
             return 0;
             
         case WM_DESTROY:
-            KillTimer(hWnd, 1);
             if (g_pGame) {
                 delete g_pGame;
                 g_pGame = nullptr;
@@ -74,11 +77,68 @@ LRESULT CALLBACK WindowProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lPara
     return DefWindowProc(hWnd, message, wParam, lParam);
 }
 
+// ============================================================================
+// 命令列參數
+// ============================================================================
+
+// 讀取 "--name N" 形式的整數，找不到時回傳預設值
+int GetCommandLineInt(const wchar_t* cmdLine, const wchar_t* name, int defaultValue) {
+    if (!cmdLine) return defaultValue;
+    
+    const wchar_t* found = wcsstr(cmdLine, name);
+    if (!found) return defaultValue;
+    
+    wchar_t* end = nullptr;
+    long value = wcstol(found + wcslen(name), &end, 10);
+    return end == found + wcslen(name) ? defaultValue : (int)value;
+}
+
+// 讀取 "--name N" 形式的 64 位元無號整數（種子），找不到時回傳預設值
+uint64_t GetCommandLineUInt64(const wchar_t* cmdLine, const wchar_t* name, uint64_t defaultValue) {
+    if (!cmdLine) return defaultValue;
+    
+    const wchar_t* found = wcsstr(cmdLine, name);
+    if (!found) return defaultValue;
+    
+    wchar_t* end = nullptr;
+    unsigned long long value = wcstoull(found + wcslen(name), &end, 10);
+    return end == found + wcslen(name) ? defaultValue : (uint64_t)value;
+}
+
+// 讀取 "--name value" 形式的字串（不含空白），找不到時回傳空字串
+std::wstring GetCommandLineString(const wchar_t* cmdLine, const wchar_t* name) {
+    if (!cmdLine) return std::wstring();
+    
+    const wchar_t* found = wcsstr(cmdLine, name);
+    if (!found) return std::wstring();
+    
+    const wchar_t* begin = found + wcslen(name);
+    while (*begin == L' ') begin++;
+    const wchar_t* end = begin;
+    while (*end && *end != L' ') end++;
+    return std::wstring(begin, end);
+}
+
 // ============================================================================
 // 程式進入點
 // ============================================================================
 int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, 
                     LPWSTR lpCmdLine, int nCmdShow) {
+    // 亂數種子：--seed N（預設取目前時間；HUD 會顯示種子以便重現）
+    g_seed = GetCommandLineUInt64(lpCmdLine, L"--seed", (uint64_t)time(nullptr));
+    
+    // 輸入錄製：--record FILE（結束遊戲時寫入）
+    g_recordPath = GetCommandLineString(lpCmdLine, L"--record");
+    
+    // 內容檔：--content FILE（預設 data/content.txt；編譯快取寫在 herowar_content.bin）
+    g_contentPath = GetCommandLineString(lpCmdLine, L"--content");
+    if (g_contentPath.empty()) {
+        g_contentPath = L"data/content.txt";
+    }
+    
+    // 繪製後端：--renderer software（預設 GDI，遊戲中按 F5 切換）
+    g_softwareRenderer = GetCommandLineString(lpCmdLine, L"--renderer") == L"software";
+    
     // 註冊視窗類別
     WNDCLASSEX wc = {};
     wc.cbSize = sizeof(WNDCLASSEX);
@@ -130,11 +190,34 @@ int WINAPI wWinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance,
     ShowWindow(hWnd, nCmdShow);
     UpdateWindow(hWnd);
     
-    // 訊息迴圈
+    // 幀率上限：--fps N（預設 60，0 表示不限幀率）
+    FrameTimer frameTimer(GetCommandLineInt(lpCmdLine, L"--fps", 60));
+    
+    // 遊戲迴圈：先處理完所有待處理訊息，再更新與繪製一幀
     MSG msg = {};
-    while (GetMessage(&msg, NULL, 0, 0)) {
-        TranslateMessage(&msg);
-        DispatchMessage(&msg);
+    bool running = true;
+    while (running) {
+        while (PeekMessage(&msg, NULL, 0, 0, PM_REMOVE)) {
+            if (msg.message == WM_QUIT) {
+                running = false;
+                break;
+            }
+            TranslateMessage(&msg);
+            DispatchMessage(&msg);
+        }
+        if (!running || !g_pGame) break;
+        
+        g_pGame->Update(frameTimer.BeginFrame());
+        InvalidateRect(hWnd, NULL, FALSE);
+        UpdateWindow(hWnd);
+        
+        frameTimer.WaitForNextFrame();
+    }
+    
+    // 沒有經過 WM_DESTROY 就結束時（例如收到其他來源的 WM_QUIT），在這裡釋放並寫入錄製檔
+    if (g_pGame) {
+        delete g_pGame;
+        g_pGame = nullptr;
     }
     
     return (int)msg.wParam;
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+// ============================================================================
+// 唯讀記憶體映射檔
+// Windows 使用 CreateFileMapping / MapViewOfFile，其他平台使用 mmap；
+// 只在這個檔案裡處理平台差異，模擬核心其餘部分不需引入系統標頭
+// ============================================================================
+class MappedFile {
+private:
+    const uint8_t* data_;
+    size_t size_;
+#ifdef _WIN32
+    void* file_;                 // HANDLE
+    void* mapping_;              // HANDLE
+#else
+    int fd_;
+#endif
+
+public:
+    MappedFile();
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool Open(const std::filesystem::path& path);
+    void Close();
+    void Swap(MappedFile& other);
+
+    // 存取方法
+    bool IsOpen() const { return data_ != nullptr; }
+    const uint8_t* GetData() const { return data_; }
+    size_t GetSize() const { return size_; }
+};
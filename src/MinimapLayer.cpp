@@ -0,0 +1,93 @@
+#include "MinimapLayer.h"
+#include "MonsterPool.h"
+#include "Profiler.h"
+#include <algorithm>
+
+using namespace GameConstants;
+
+MinimapLayer::MinimapLayer(int worldWidth, int worldHeight)
+    : worldWidth_(worldWidth)
+    , worldHeight_(worldHeight)
+    , scaleX_(0)
+    , scaleY_(0)
+    , interval_(DEFAULT_INTERVAL)
+    , framesSinceRedraw_(0)
+    , dirty_(true)
+    , lastAlive_(-1)
+    , lastExperience_(-1)
+    , background_(Rasterizer::ToPixel(MakeColor(50, 80, 50)))
+    , dot_(Rasterizer::ToPixel(MakeColor(255, 0, 0)))
+    , redrawCount_(0)
+    , lastRedrawMs_(0)
+{
+}
+
+void MinimapLayer::Allocate(int width, int height) {
+    surface_.Allocate(width, height);
+    UpdateScale();
+}
+
+void MinimapLayer::Attach(uint32_t* pixels, int width, int height, int pitch) {
+    surface_.Attach(pixels, width, height, pitch);
+    UpdateScale();
+}
+
+void MinimapLayer::SetColors(Color background, Color dot) {
+    background_ = Rasterizer::ToPixel(background);
+    dot_ = Rasterizer::ToPixel(dot);
+    dirty_ = true;
+}
+
+void MinimapLayer::UpdateScale() {
+    scaleX_ = (float)surface_.GetWidth() / worldWidth_;
+    scaleY_ = (float)surface_.GetHeight() / worldHeight_;
+    dirty_ = true;
+}
+
+bool MinimapLayer::Update(const MonsterPool& monsters) {
+    if (!surface_.IsReady()) return false;
+
+    framesSinceRedraw_++;
+    const MonsterPopulation& population = monsters.GetPopulation();
+    bool populationChanged = population.alive != lastAlive_ || population.remainingExperience != lastExperience_;
+    if (!dirty_ && !populationChanged && framesSinceRedraw_ < interval_) return false;
+
+    uint64_t startNs = Profiler::NowNs();
+    Plot(monsters);
+    lastRedrawMs_ = (Profiler::NowNs() - startNs) / 1e6;
+
+    lastAlive_ = population.alive;
+    lastExperience_ = population.remainingExperience;
+    framesSinceRedraw_ = 0;
+    dirty_ = false;
+    redrawCount_++;
+    return true;
+}
+
+void MinimapLayer::Plot(const MonsterPool& monsters) {
+    surface_.Clear(background_);
+
+    const int count = monsters.GetAliveCount();
+    const int size = count > DENSE_MONSTERS ? 2 : 4;
+    const int maxX = surface_.GetWidth() - size;
+    const int maxY = surface_.GetHeight() - size;
+    if (maxX < 0 || maxY < 0) return;
+
+    // 每個點直接寫入像素，不經過任何繪圖呼叫；點以怪獸左上角為中心，貼齊邊界
+    uint32_t* pixels = surface_.GetPixels();
+    const int pitch = surface_.GetPitch();
+    const int* ids = monsters.GetActiveIds();
+    const float* posX = monsters.GetPositionsX();
+    const float* posY = monsters.GetPositionsY();
+    for (int i = 0; i < count; i++) {
+        int id = ids[i];
+        int x = std::max(0, std::min(ToMapX(posX[id]) - size / 2, maxX));
+        int y = std::max(0, std::min(ToMapY(posY[id]) - size / 2, maxY));
+        uint32_t* row = pixels + (size_t)y * pitch + x;
+        for (int dy = 0; dy < size; dy++, row += pitch) {
+            for (int dx = 0; dx < size; dx++) {
+                row[dx] = dot_;
+            }
+        }
+    }
+}
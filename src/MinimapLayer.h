@@ -0,0 +1,68 @@
+#pragma once
+#include "Rasterizer.h"
+#include "Types.h"
+#include <cstdint>
+
+class MonsterPool;
+
+// ============================================================================
+// 小地圖圖層
+// 怪獸點直接寫入小地圖大小的像素緩衝區，每隔固定幀數才重畫一次，其餘幀沿用上次的結果；
+// 怪獸生成或死亡時（存活數或剩餘經驗改變）提早重畫，點不會比實際多或少太久
+// 預設間隔約等於怪獸在小地圖上移動一個像素所需的幀數，重畫間隔內的位置變化不到一個像素
+// 英雄與視野框每幀都會移動，由呼叫端在貼上圖層後另外繪製
+// 緩衝區可自行配置，也可掛上外部記憶體（Windows 的 DIB section，貼到畫面只需一次 BitBlt）
+// ============================================================================
+class MinimapLayer {
+public:
+    static constexpr int DEFAULT_INTERVAL = 8;           // 重畫間隔（幀）
+    static constexpr int DENSE_MONSTERS = 2000;          // 超過此數量時點縮小為 2x2，避免整片塗滿
+
+private:
+    Rasterizer surface_;
+    int worldWidth_;
+    int worldHeight_;
+    float scaleX_;                       // 世界座標到小地圖像素的比例
+    float scaleY_;
+    int interval_;
+    int framesSinceRedraw_;
+    bool dirty_;                         // 下次 Update 必定重畫
+    int lastAlive_;                      // 上次重畫時的族群統計（偵測生成與死亡）
+    int lastExperience_;
+    uint32_t background_;
+    uint32_t dot_;
+    int redrawCount_;
+    double lastRedrawMs_;
+
+    void UpdateScale();
+    void Plot(const MonsterPool& monsters);
+
+public:
+    MinimapLayer(int worldWidth = GameConstants::MAP_WIDTH, int worldHeight = GameConstants::MAP_HEIGHT);
+
+    MinimapLayer(const MinimapLayer&) = delete;
+    MinimapLayer& operator=(const MinimapLayer&) = delete;
+
+    // 表面
+    void Allocate(int width, int height);
+    void Attach(uint32_t* pixels, int width, int height, int pitch);
+    void Detach() { surface_.Detach(); }
+    void SetColors(Color background, Color dot);
+
+    // 重畫間隔（1 表示每幀重畫）
+    void SetInterval(int frames) { interval_ = frames < 1 ? 1 : frames; }
+    int GetInterval() const { return interval_; }
+    void Invalidate() { dirty_ = true; }
+
+    // 每幀呼叫一次；間隔已到或怪獸有生成、死亡時重畫，回傳是否重畫
+    bool Update(const MonsterPool& monsters);
+
+    // 世界座標轉小地圖像素
+    int ToMapX(float x) const { return (int)(x * scaleX_); }
+    int ToMapY(float y) const { return (int)(y * scaleY_); }
+
+    // 存取方法
+    const Rasterizer& GetSurface() const { return surface_; }
+    int GetRedrawCount() const { return redrawCount_; }
+    double GetLastRedrawMs() const { return lastRedrawMs_; }
+};
@@ -0,0 +1,366 @@
+#include "MonsterPool.h"
+#include "FlowField.h"
+#include "JobSystem.h"
+#include "SpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace GameConstants;
+
+MonsterPool::MonsterPool(SpatialGrid* grid)
+    : lodStats_()
+    , population_()
+    , lodEnabled_(false)
+    , frame_(0)
+    , grid_(grid)
+    , flowField_(nullptr)
+    , seed_(1)
+{
+}
+
+void MonsterPool::SetSeed(uint64_t seed) {
+    seed_ = seed;
+    ReseedChunks();
+}
+
+void MonsterPool::ReseedChunks() {
+    for (size_t chunk = 0; chunk < chunkRng_.size(); chunk++) {
+        chunkRng_[chunk].Seed(seed_, (uint64_t)chunk);
+    }
+}
+
+void MonsterPool::Clear() {
+    // 只重設狀態，保留已配置的容量
+    for (int id : active_) {
+        alive_[id] = 0;
+        if (grid_) {
+            grid_->Remove(id);
+        }
+    }
+    active_.clear();
+    for (auto& list : lodList_) {
+        list.clear();
+    }
+    population_ = MonsterPopulation();
+    
+    // 由高到低推入，讓 Spawn 依 0, 1, 2... 的順序取用槽位
+    freeList_.clear();
+    for (int id = GetCapacity() - 1; id >= 0; id--) {
+        freeList_.push_back(id);
+    }
+    ReseedChunks();
+}
+
+void MonsterPool::Reserve(int capacity) {
+    if (capacity == GetCapacity()) {
+        Clear();
+        return;
+    }
+    
+    posX_.assign(capacity, 0.0f);
+    posY_.assign(capacity, 0.0f);
+    prevX_.assign(capacity, 0.0f);
+    prevY_.assign(capacity, 0.0f);
+    hp_.assign(capacity, 0);
+    level_.assign(capacity, 1);
+    alive_.assign(capacity, 0);
+    wanderTimer_.assign(capacity, 0.0f);
+    wanderDir_.assign(capacity, (uint8_t)Direction::None);
+    facing_.assign(capacity, (uint8_t)Direction::Right);
+    meleeTimer_.assign(capacity, 0.0f);
+    lodTier_.assign(capacity, (uint8_t)LodTier::Near);
+    lodIndex_.assign(capacity, -1);
+    lastUpdate_.assign(capacity, 0);
+    activeIndex_.assign(capacity, -1);
+    active_.clear();
+    active_.reserve(capacity);
+    freeList_.reserve(capacity);
+    chunkRng_.resize((capacity + UPDATE_CHUNK - 1) / UPDATE_CHUNK);
+    for (auto& list : lodList_) {
+        list.reserve(capacity);
+    }
+    due_.reserve(capacity);
+    
+    if (grid_) {
+        grid_->Clear();
+        grid_->Reserve(capacity);
+    }
+    Clear();
+}
+
+int MonsterPool::Spawn(Vector2D pos, int level) {
+    if (freeList_.empty()) return -1;
+    
+    int id = freeList_.back();
+    freeList_.pop_back();
+    
+    posX_[id] = pos.x;
+    posY_[id] = pos.y;
+    prevX_[id] = pos.x;
+    prevY_[id] = pos.y;
+    hp_[id] = MaxHpForLevel(level);
+    level_[id] = level;
+    alive_[id] = 1;
+    wanderTimer_[id] = 2.0f;
+    wanderDir_[id] = (uint8_t)Direction::None;
+    facing_[id] = (uint8_t)Direction::Right;
+    meleeTimer_[id] = MELEE_INTERVAL;       // 剛生成的怪獸要等一輪冷卻才能出手
+    activeIndex_[id] = (int)active_.size();
+    active_.push_back(id);
+    population_.alive++;
+    population_.levelCounts[level]++;
+    population_.remainingExperience += ExperienceForLevel(level);
+    
+    // 新怪獸先列為近距離，第一次更新後再依位置分級
+    lastUpdate_[id] = frame_ - 1;
+    lodTier_[id] = (uint8_t)LodTier::Near;
+    lodIndex_[id] = (int)lodList_[(int)LodTier::Near].size();
+    lodList_[(int)LodTier::Near].push_back(id);
+    
+    if (grid_) {
+        grid_->Insert(id, pos);
+    }
+    return id;
+}
+
+void MonsterPool::Release(int id) {
+    // 以最後一個存活 ID 填補空位，維持 active_ 緊密排列
+    int index = activeIndex_[id];
+    int last = active_.back();
+    active_[index] = last;
+    activeIndex_[last] = index;
+    active_.pop_back();
+    activeIndex_[id] = -1;
+    RemoveFromLodList(id);
+    population_.alive--;
+    population_.levelCounts[level_[id]]--;
+    population_.remainingExperience -= ExperienceForLevel(level_[id]);
+    
+    alive_[id] = 0;
+    freeList_.push_back(id);
+    
+    if (grid_) {
+        grid_->Remove(id);
+    }
+}
+
+void MonsterPool::Update(float deltaTime, JobSystem* jobs) {
+    // 關閉 LOD 時直接更新全部存活怪獸
+    const int* ids = active_.data();
+    int count = GetAliveCount();
+    if (lodEnabled_) {
+        CollectDue();
+        ids = due_.data();
+        count = (int)due_.size();
+    }
+    
+    // 平行階段只寫入各自區塊的欄位，不碰空間索引
+    if (jobs) {
+        jobs->ParallelFor(count, UPDATE_CHUNK, [&](int begin, int end, int chunk) {
+            UpdateRange(ids, begin, end, deltaTime, chunkRng_[chunk]);
+        });
+    } else {
+        for (int begin = 0; begin < count; begin += UPDATE_CHUNK) {
+            int end = std::min(count, begin + UPDATE_CHUNK);
+            UpdateRange(ids, begin, end, deltaTime, chunkRng_[begin / UPDATE_CHUNK]);
+        }
+    }
+    
+    // 只有更新過的怪獸位置會改變
+    if (grid_) {
+        for (int i = 0; i < count; i++) {
+            grid_->Update(ids[i], Vector2D(posX_[ids[i]], posY_[ids[i]]));
+        }
+    }
+    
+    if (lodEnabled_) {
+        Retier();
+    }
+    
+    lodStats_.nearCount = (int)lodList_[(int)LodTier::Near].size();
+    lodStats_.midCount = (int)lodList_[(int)LodTier::Mid].size();
+    lodStats_.farCount = (int)lodList_[(int)LodTier::Far].size();
+    lodStats_.updated = count;
+    frame_++;
+}
+
+// 本步輪到的怪獸：近距離全部，中、遠距離清單各以固定間距取一段（依步序號輪替起點）
+void MonsterPool::CollectDue() {
+    due_.clear();
+    const std::vector<int>& nearList = lodList_[(int)LodTier::Near];
+    due_.insert(due_.end(), nearList.begin(), nearList.end());
+    
+    const std::vector<int>& midList = lodList_[(int)LodTier::Mid];
+    for (size_t i = frame_ % LOD_MID_INTERVAL; i < midList.size(); i += LOD_MID_INTERVAL) {
+        due_.push_back(midList[i]);
+    }
+    
+    const std::vector<int>& farList = lodList_[(int)LodTier::Far];
+    for (size_t i = frame_ % LOD_FAR_INTERVAL; i < farList.size(); i += LOD_FAR_INTERVAL) {
+        due_.push_back(farList[i]);
+    }
+}
+
+// 依更新後的位置調整等級；在清單間搬移會打亂間距，個別怪獸偶爾多等或少等幾步，
+// 延後的步數由 lastUpdate_ 推算，不會遺失
+void MonsterPool::Retier() {
+    for (int id : due_) {
+        LodTier tier = ClassifyLod(id);
+        if (tier != (LodTier)lodTier_[id]) {
+            SetLodTier(id, tier);
+        }
+    }
+}
+
+LodTier MonsterPool::ClassifyLod(int id) const {
+    float dx = std::fabs(posX_[id] + MONSTER_SIZE * 0.5f - lodFocus_.x);
+    float dy = std::fabs(posY_[id] + MONSTER_SIZE * 0.5f - lodFocus_.y);
+    if (dx <= LOD_NEAR_HALF_WIDTH && dy <= LOD_NEAR_HALF_HEIGHT) return LodTier::Near;
+    if (dx <= LOD_NEAR_HALF_WIDTH * LOD_MID_SCALE && dy <= LOD_NEAR_HALF_HEIGHT * LOD_MID_SCALE) return LodTier::Mid;
+    return LodTier::Far;
+}
+
+void MonsterPool::RemoveFromLodList(int id) {
+    // 與 active_ 相同，以清單最後一個 ID 填補空位
+    std::vector<int>& list = lodList_[lodTier_[id]];
+    int last = list.back();
+    list[lodIndex_[id]] = last;
+    lodIndex_[last] = lodIndex_[id];
+    list.pop_back();
+    lodIndex_[id] = -1;
+}
+
+void MonsterPool::SetLodTier(int id, LodTier tier) {
+    RemoveFromLodList(id);
+    
+    std::vector<int>& to = lodList_[(int)tier];
+    lodTier_[id] = (uint8_t)tier;
+    lodIndex_[id] = (int)to.size();
+    to.push_back(id);
+}
+
+void MonsterPool::UpdateRange(const int* ids, int begin, int end, float deltaTime, Random& rng) {
+    for (int i = begin; i < end; i++) {
+        int id = ids[i];
+        
+        // 補上自上次更新以來的步數（每步更新時為 1）
+        uint32_t steps = std::min<uint32_t>(frame_ - lastUpdate_[id], LOD_MAX_STEPS);
+        lastUpdate_[id] = frame_;
+        float elapsed = deltaTime * steps;
+        
+        meleeTimer_[id] = std::max(0.0f, meleeTimer_[id] - elapsed);
+        bool coarse = lodEnabled_ && (LodTier)lodTier_[id] == LodTier::Far;
+        if (coarse || !ChaseStep(id, (float)steps)) {
+            WanderStep(id, elapsed, (float)steps, rng);
+        }
+    }
+}
+
+void MonsterPool::StorePreviousPositions() {
+    std::copy(posX_.begin(), posX_.end(), prevX_.begin());
+    std::copy(posY_.begin(), posY_.end(), prevY_.begin());
+}
+
+void MonsterPool::Move(int id, Direction dir) {
+    if (!alive_[id]) return;
+    
+    Step(id, dir);
+    
+    if (grid_) {
+        grid_->Update(id, Vector2D(posX_[id], posY_[id]));
+    }
+}
+
+void MonsterPool::Step(int id, Direction dir, float steps) {
+    facing_[id] = (uint8_t)dir;
+    
+    float speed = SpeedForLevel(level_[id]) * steps;
+    float x = posX_[id];
+    float y = posY_[id];
+    switch (dir) {
+        case Direction::Up:
+            y -= speed;
+            break;
+        case Direction::Down:
+            y += speed;
+            break;
+        case Direction::Left:
+            x -= speed;
+            break;
+        case Direction::Right:
+            x += speed;
+            break;
+        default:
+            break;
+    }
+    
+    posX_[id] = std::max(0.0f, std::min(x, (float)(MAP_WIDTH - MONSTER_SIZE)));
+    posY_[id] = std::max(0.0f, std::min(y, (float)(MAP_HEIGHT - MONSTER_SIZE)));
+}
+
+void MonsterPool::Wander(int id, float deltaTime) {
+    if (!alive_[id]) return;
+    
+    WanderStep(id, deltaTime, 1.0f, chunkRng_[activeIndex_[id] / UPDATE_CHUNK]);
+    
+    if (grid_) {
+        grid_->Update(id, Vector2D(posX_[id], posY_[id]));
+    }
+}
+
+void MonsterPool::WanderStep(int id, float deltaTime, float steps, Random& rng) {
+    // 換方向時才抽下一段漫遊時間（2.0 ~ 3.9 秒），平時不必產生亂數
+    wanderTimer_[id] -= deltaTime;
+    
+    if (wanderTimer_[id] <= 0) {
+        wanderTimer_[id] = 2.0f + rng.NextInt(20) / 10.0f;
+        wanderDir_[id] = (uint8_t)rng.NextInt(5);
+    }
+    
+    if (wanderDir_[id] != (uint8_t)Direction::None) {
+        Step(id, static_cast<Direction>(wanderDir_[id]), steps);
+    }
+}
+
+void MonsterPool::Displace(int id, Vector2D offset) {
+    if (!alive_[id]) return;
+    
+    posX_[id] = std::max(0.0f, std::min(posX_[id] + offset.x, (float)(MAP_WIDTH - MONSTER_SIZE)));
+    posY_[id] = std::max(0.0f, std::min(posY_[id] + offset.y, (float)(MAP_HEIGHT - MONSTER_SIZE)));
+    
+    if (grid_) {
+        grid_->Update(id, Vector2D(posX_[id], posY_[id]));
+    }
+}
+
+bool MonsterPool::ChaseStep(int id, float steps) {
+    if (!flowField_) return false;
+    
+    // 以中心取樣流場；超出追擊距離時交回漫遊
+    Vector2D center(posX_[id] + MONSTER_SIZE * 0.5f, posY_[id] + MONSTER_SIZE * 0.5f);
+    int distance;
+    Direction dir = flowField_->GetDirection(center, distance);
+    if (distance > CHASE_TILES) return false;
+    
+    if (dir != Direction::None) {
+        Step(id, dir, steps);
+    }
+    return true;
+}
+
+int MonsterPool::Strike(int id) {
+    if (!alive_[id] || meleeTimer_[id] > 0) return 0;
+    
+    meleeTimer_[id] = MELEE_INTERVAL;
+    return AttackForLevel(level_[id]);
+}
+
+void MonsterPool::TakeDamage(int id, int damage) {
+    if (!alive_[id]) return;
+    
+    hp_[id] -= damage;
+    if (hp_[id] <= 0) {
+        hp_[id] = 0;
+        Release(id);
+    }
+}
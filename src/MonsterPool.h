@@ -0,0 +1,201 @@
+#pragma once
+#include "Random.h"
+#include "Types.h"
+#include <cstdint>
+#include <vector>
+
+class FlowField;
+class JobSystem;
+class SpatialGrid;
+class MonsterPool;
+
+// ============================================================================
+// 怪獸類別（MonsterPool 中單一怪獸的輕量控制代碼）
+// ============================================================================
+class Monster {
+private:
+    MonsterPool* pool_;      // 所屬怪獸池
+    int id_;                 // 在怪獸池中的索引
+
+public:
+    Monster(MonsterPool* pool, int id) : pool_(pool), id_(id) {}
+
+    // 基本屬性存取
+    int GetId() const { return id_; }
+    Vector2D GetPosition() const;
+    Vector2D GetInterpolatedPosition(float alpha) const;
+    int GetLevel() const;
+    int GetMaxHp() const;
+    int GetCurrentHp() const;
+    int GetAttack() const;
+    int GetSize() const { return GameConstants::MONSTER_SIZE; }
+    bool IsAlive() const;
+    Direction GetFacing() const;
+
+    // 行為方法
+    void Move(Direction dir);
+    void TakeDamage(int damage);
+    void Wander(float deltaTime);
+    void Update(float deltaTime);
+    int GetExperienceReward() const;
+};
+
+// ============================================================================
+// 更新頻率分級（LOD）統計（最近一次 Update）
+// ============================================================================
+enum class LodTier : uint8_t {
+    Near,           // 畫面附近：每步更新
+    Mid,            // 中距離：每 LOD_MID_INTERVAL 步更新一次
+    Far,            // 遠方：每 LOD_FAR_INTERVAL 步粗略更新一次（只漫遊，不取樣流場）
+    Count
+};
+
+struct MonsterLodStats {
+    int nearCount;
+    int midCount;
+    int farCount;
+    int updated;             // 本步實際執行更新的怪獸數
+};
+
+// ============================================================================
+// 存活族群統計（生成與死亡時增量維護，查詢不需掃過怪獸）
+// ============================================================================
+struct MonsterPopulation {
+    int alive;
+    int levelCounts[GameConstants::MAX_MONSTER_LEVEL + 1];   // 各等級的存活數（索引為等級，0 不使用）
+    int remainingExperience;                                 // 全部擊殺可獲得的經驗總和
+};
+
+// ============================================================================
+// 怪獸池（Structure of Arrays）
+// 每個欄位各自連續存放，每幀的批次更新可線性掃過記憶體
+// 固定容量：死亡的槽位進入空閒清單供之後的怪獸重用，存活 ID 另以緊密陣列維護
+// ============================================================================
+class MonsterPool {
+private:
+    std::vector<float> posX_;            // X 座標
+    std::vector<float> posY_;            // Y 座標
+    std::vector<float> prevX_;           // 上一個模擬步的 X 座標（繪製內插用）
+    std::vector<float> prevY_;           // 上一個模擬步的 Y 座標
+    std::vector<int> hp_;                // 當前生命值
+    std::vector<int> level_;             // 等級
+    std::vector<uint8_t> alive_;         // 是否存活
+    std::vector<float> wanderTimer_;     // 距離下次換方向的剩餘秒數
+    std::vector<uint8_t> wanderDir_;     // 漫遊方向
+    std::vector<uint8_t> facing_;        // 面向方向
+    std::vector<float> meleeTimer_;      // 距離下次可近戰攻擊的剩餘秒數
+    std::vector<uint8_t> lodTier_;       // 所屬 LOD 等級
+    std::vector<int> lodIndex_;          // 怪獸 ID 在所屬等級清單中的位置
+    std::vector<uint32_t> lastUpdate_;   // 上次更新時的步序號（延後的步數由此推算）
+    std::vector<int> active_;            // 存活怪獸 ID（緊密排列，批次更新只掃這段）
+    std::vector<int> activeIndex_;       // 怪獸 ID 在 active_ 中的位置
+    std::vector<int> freeList_;          // 可重複使用的空槽（堆疊，最近釋放的先用）
+    std::vector<Random> chunkRng_;       // 每個更新區塊的亂數串流
+    std::vector<int> lodList_[(int)LodTier::Count];   // 各等級的存活怪獸 ID
+    std::vector<int> due_;               // 本步輪到更新的怪獸 ID
+    MonsterLodStats lodStats_;
+    MonsterPopulation population_;
+    Vector2D lodFocus_;                  // LOD 的中心（畫面中心，攝影機在地圖邊緣被夾住時不在英雄身上）
+    bool lodEnabled_;                    // 關閉時所有怪獸每步更新
+    uint32_t frame_;                     // 步序號（每次 Update 加一，決定中、遠距離輪到哪一段）
+    SpatialGrid* grid_;                  // 存活怪獸的空間索引（可為空）
+    const FlowField* flowField_;         // 追擊流場（可為空，為空時全部漫遊）
+    uint64_t seed_;                      // 區塊亂數串流的種子
+
+    void UpdateRange(const int* ids, int begin, int end, float deltaTime, Random& rng);
+    void CollectDue();
+    void Retier();
+    LodTier ClassifyLod(int id) const;
+    void SetLodTier(int id, LodTier tier);
+    void WanderStep(int id, float deltaTime, float steps, Random& rng);
+    bool ChaseStep(int id, float steps);
+    void Step(int id, Direction dir, float steps = 1.0f);
+    void RemoveFromLodList(int id);
+    void Release(int id);
+    void ReseedChunks();
+
+public:
+    // 批次更新的區塊大小；亂數依區塊分流，結果與執行緒數量無關
+    static constexpr int UPDATE_CHUNK = 1024;
+
+    // LOD：以焦點為中心的矩形分級，近距離涵蓋整個畫面再留一點邊界
+    // 中、遠距離的間隔不超過畫面邊界留白可容納的英雄移動量，進入畫面前就會升回近距離
+    static constexpr float LOD_NEAR_HALF_WIDTH = GameConstants::WINDOW_WIDTH / 2 + 64.0f;
+    static constexpr float LOD_NEAR_HALF_HEIGHT = GameConstants::WINDOW_HEIGHT / 2 + 64.0f;
+    static constexpr float LOD_MID_SCALE = 2.0f;     // 中距離範圍為近距離的倍數
+    static constexpr int LOD_MID_INTERVAL = 4;
+    static constexpr int LOD_FAR_INTERVAL = 16;
+    static constexpr int LOD_MAX_STEPS = LOD_FAR_INTERVAL * 2;    // 一次補上的步數上限
+
+    explicit MonsterPool(SpatialGrid* grid = nullptr);
+
+    // 容量管理
+    // Reserve 一次配置固定容量的所有欄位；之後 Spawn / 死亡 / Clear 只在空槽間循環，不再配置記憶體
+    void SetSeed(uint64_t seed);
+    void SetFlowField(const FlowField* field) { flowField_ = field; }
+    void SetLodFocus(Vector2D focus) { lodFocus_ = focus; }
+    void SetLodEnabled(bool enabled) { lodEnabled_ = enabled; }
+    void Clear();
+    void Reserve(int capacity);
+    int Spawn(Vector2D pos, int level);      // level 為 1 ~ MAX_MONSTER_LEVEL；容量已滿時回傳 -1
+
+    // 批次更新所有存活怪獸（流場範圍內追擊英雄，其餘漫遊）；提供 jobs 時各區塊平行更新，之後再統一同步空間索引
+    // 開啟 LOD 時依與焦點的距離分級，各級各有一份 ID 清單：近距離每步全部更新，
+    // 中、遠距離清單每步只以固定間距取其中一段，未輪到的怪獸完全不會被讀取；
+    // 延後的步數在輪到時一次補上（移動距離與計時都按步數放大），更新後再依新位置調整等級
+    void Update(float deltaTime, JobSystem* jobs = nullptr);
+    
+    // 每個模擬步開始前保存位置，供繪製內插使用
+    void StorePreviousPositions();
+
+    // 單體行為
+    void Move(int id, Direction dir);
+    void Wander(int id, float deltaTime);
+    void TakeDamage(int id, int damage);
+    void Displace(int id, Vector2D offset);  // 碰撞分離：平移並限制在地圖內，不改變面向
+    int Strike(int id);                      // 近戰攻擊：冷卻結束時回傳傷害並重新計時，否則回傳 0
+
+    // 存取方法（ID 為槽位索引，在怪獸死亡前保持不變）
+    Monster Get(int id) { return Monster(this, id); }
+    int GetCapacity() const { return (int)posX_.size(); }
+    int GetAliveCount() const { return (int)active_.size(); }
+    int GetFreeCount() const { return (int)freeList_.size(); }
+    const int* GetActiveIds() const { return active_.data(); }
+    Vector2D GetPosition(int id) const { return Vector2D(posX_[id], posY_[id]); }
+    Vector2D GetInterpolatedPosition(int id, float alpha) const {
+        return Vector2D(prevX_[id] + (posX_[id] - prevX_[id]) * alpha,
+                        prevY_[id] + (posY_[id] - prevY_[id]) * alpha);
+    }
+    int GetLevel(int id) const { return level_[id]; }
+    int GetCurrentHp(int id) const { return hp_[id]; }
+    bool IsAlive(int id) const { return alive_[id] != 0; }
+    Direction GetFacing(int id) const { return static_cast<Direction>(facing_[id]); }
+    const MonsterLodStats& GetLodStats() const { return lodStats_; }
+    const MonsterPopulation& GetPopulation() const { return population_; }
+    const float* GetPositionsX() const { return posX_.data(); }
+    const float* GetPositionsY() const { return posY_.data(); }
+    const uint8_t* GetAliveFlags() const { return alive_.data(); }
+
+    // 依等級推導的屬性
+    static int MaxHpForLevel(int level) { return GameConstants::BASE_HP + (level - 1) * GameConstants::HP_PER_LEVEL; }
+    static int AttackForLevel(int level) { return GameConstants::BASE_ATTACK + (level - 1) * GameConstants::ATTACK_PER_LEVEL; }
+    static float SpeedForLevel(int level) { return GameConstants::MONSTER_SPEED + level * 0.2f; }
+    static int ExperienceForLevel(int level) { return level * 50; }
+};
+
+// ============================================================================
+// Monster 內嵌實作
+// ============================================================================
+inline Vector2D Monster::GetPosition() const { return pool_->GetPosition(id_); }
+inline Vector2D Monster::GetInterpolatedPosition(float alpha) const { return pool_->GetInterpolatedPosition(id_, alpha); }
+inline int Monster::GetLevel() const { return pool_->GetLevel(id_); }
+inline int Monster::GetMaxHp() const { return MonsterPool::MaxHpForLevel(GetLevel()); }
+inline int Monster::GetCurrentHp() const { return pool_->GetCurrentHp(id_); }
+inline int Monster::GetAttack() const { return MonsterPool::AttackForLevel(GetLevel()); }
+inline bool Monster::IsAlive() const { return pool_->IsAlive(id_); }
+inline Direction Monster::GetFacing() const { return pool_->GetFacing(id_); }
+inline void Monster::Move(Direction dir) { pool_->Move(id_, dir); }
+inline void Monster::TakeDamage(int damage) { pool_->TakeDamage(id_, damage); }
+inline void Monster::Wander(float deltaTime) { pool_->Wander(id_, deltaTime); }
+inline void Monster::Update(float deltaTime) { if (IsAlive()) Wander(deltaTime); }
+inline int Monster::GetExperienceReward() const { return MonsterPool::ExperienceForLevel(GetLevel()); }
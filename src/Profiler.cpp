@@ -0,0 +1,136 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+Profiler::Profiler()
+    : events_(EVENT_CAPACITY)
+    , eventCursor_(0)
+    , frames_(FRAME_HISTORY)
+    , frameCount_(0)
+{
+    for (auto& zone : zoneNs_) zone.store(0);
+    originNs_ = NowNs();
+    frameStartNs_ = originNs_;
+}
+
+uint64_t Profiler::NowNs() {
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+}
+
+uint32_t Profiler::CurrentThreadId() {
+    static std::atomic<uint32_t> nextId(0);
+    thread_local uint32_t id = nextId.fetch_add(1);
+    return id;
+}
+
+const char* Profiler::GetZoneName(ProfileZone zone) {
+    switch (zone) {
+        case ProfileZone::Input:         return "Input";
+        case ProfileZone::MonsterUpdate: return "MonsterUpdate";
+        case ProfileZone::Attack:        return "Attack";
+        case ProfileZone::Collision:     return "Collision";
+        case ProfileZone::Camera:        return "Camera";
+        case ProfileZone::Background:    return "Background";
+        case ProfileZone::Entities:      return "Entities";
+        case ProfileZone::Minimap:       return "Minimap";
+        case ProfileZone::HUD:           return "HUD";
+        case ProfileZone::Blit:          return "BitBlt";
+        default:                         return "Frame";
+    }
+}
+
+void Profiler::PushEvent(uint8_t zone, uint64_t startNs, uint64_t endNs) {
+    // 每個寫入者取得獨立的位置，不需上鎖；緩衝滿時覆寫最舊的事件
+    uint64_t index = eventCursor_.fetch_add(1, std::memory_order_relaxed);
+    Event& event = events_[index & (EVENT_CAPACITY - 1)];
+    event.startNs = startNs;
+    event.durationNs = endNs - startNs;
+    event.threadId = CurrentThreadId();
+    event.zone = zone;
+}
+
+void Profiler::Record(ProfileZone zone, uint64_t startNs, uint64_t endNs) {
+    zoneNs_[(int)zone].fetch_add(endNs - startNs, std::memory_order_relaxed);
+    PushEvent((uint8_t)zone, startNs, endNs);
+}
+
+void Profiler::BeginFrame() {
+    uint64_t now = NowNs();
+
+    FrameRecord& record = frames_[frameCount_ % FRAME_HISTORY];
+    record.frameMs = (now - frameStartNs_) / 1.0e6;
+    for (int i = 0; i < ZONE_COUNT; i++) {
+        record.zoneMs[i] = zoneNs_[i].exchange(0, std::memory_order_relaxed) / 1.0e6;
+    }
+    PushEvent((uint8_t)ProfileZone::Count, frameStartNs_, now);
+
+    frameCount_++;
+    frameStartNs_ = now;
+}
+
+int Profiler::GetHistorySize() const {
+    return (int)std::min<uint64_t>(frameCount_, FRAME_HISTORY);
+}
+
+double Profiler::GetFrameMs(int framesAgo) const {
+    if (framesAgo < 0 || framesAgo >= GetHistorySize()) return 0;
+    return frames_[(frameCount_ - 1 - framesAgo) % FRAME_HISTORY].frameMs;
+}
+
+ZoneStats Profiler::ComputeStats(int zone) const {
+    ZoneStats stats = { 0, 0, 0 };
+    int count = GetHistorySize();
+    if (count == 0) return stats;
+
+    double samples[FRAME_HISTORY];
+    double sum = 0;
+    for (int i = 0; i < count; i++) {
+        const FrameRecord& record = frames_[i];
+        samples[i] = zone < 0 ? record.frameMs : record.zoneMs[zone];
+        sum += samples[i];
+    }
+
+    int p99Index = (int)(0.99 * (count - 1));
+    std::nth_element(samples, samples + p99Index, samples + count);
+    stats.p99Ms = samples[p99Index];
+    stats.minMs = *std::min_element(samples, samples + count);
+    stats.avgMs = sum / count;
+    return stats;
+}
+
+ZoneStats Profiler::GetZoneStats(ProfileZone zone) const {
+    return ComputeStats((int)zone);
+}
+
+ZoneStats Profiler::GetFrameStats() const {
+    return ComputeStats(-1);
+}
+
+bool Profiler::WriteChromeTrace(const char* path) const {
+    FILE* file = std::fopen(path, "w");
+    if (!file) return false;
+
+    uint64_t end = eventCursor_.load(std::memory_order_acquire);
+    uint64_t begin = end > (uint64_t)EVENT_CAPACITY ? end - EVENT_CAPACITY : 0;
+
+    // 時間單位為微秒；"X" 為含持續時間的完整事件
+    std::fprintf(file, "{\"traceEvents\":[\n");
+    bool first = true;
+    for (uint64_t i = begin; i < end; i++) {
+        const Event& event = events_[i & (EVENT_CAPACITY - 1)];
+        if (event.startNs < originNs_) continue;
+
+        std::fprintf(file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                     first ? "" : ",\n",
+                     GetZoneName((ProfileZone)event.zone),
+                     event.threadId,
+                     (event.startNs - originNs_) / 1000.0,
+                     event.durationNs / 1000.0);
+        first = false;
+    }
+    std::fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+    return std::fclose(file) == 0;
+}
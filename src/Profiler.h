@@ -0,0 +1,110 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+// ============================================================================
+// 效能分析區段
+// ============================================================================
+enum class ProfileZone : uint8_t {
+    Input,          // 輸入處理
+    MonsterUpdate,  // 怪獸更新
+    Attack,         // 攻擊判定
+    Collision,      // 碰撞分離
+    Camera,         // 攝影機
+    Background,     // 背景
+    Entities,       // 角色繪製
+    Minimap,        // 小地圖
+    HUD,            // 介面文字
+    Blit,           // 後緩衝貼到視窗
+    Count
+};
+
+// 區段統計（毫秒）
+struct ZoneStats {
+    double minMs;
+    double avgMs;
+    double p99Ms;
+};
+
+// ============================================================================
+// 幀效能分析器
+// 每個區段的起訖時間寫入固定大小的環狀緩衝（以原子游標配置位置，可跨執行緒寫入），
+// 同時累加到本幀的區段總和；BeginFrame 時把上一幀的總和存入幀歷史
+// 與平台無關，模擬核心與 Win32 前端共用
+// ============================================================================
+class Profiler {
+public:
+    static constexpr int ZONE_COUNT = (int)ProfileZone::Count;
+    static constexpr int FRAME_HISTORY = 240;       // 保留的幀數
+    static constexpr int EVENT_CAPACITY = 1 << 16;  // 環狀緩衝事件數（2 的次方）
+
+    Profiler();
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    // 結束上一幀並開始新的一幀
+    void BeginFrame();
+
+    // 記錄一個區段（通常經由 ProfileScope）
+    void Record(ProfileZone zone, uint64_t startNs, uint64_t endNs);
+
+    // 統計（取最近 FRAME_HISTORY 幀）
+    ZoneStats GetZoneStats(ProfileZone zone) const;
+    ZoneStats GetFrameStats() const;
+    int GetHistorySize() const;
+    double GetFrameMs(int framesAgo) const;         // 0 = 最近完成的一幀
+
+    // 輸出最近的事件為 Chrome trace JSON（chrome://tracing 或 Perfetto 可開啟）
+    bool WriteChromeTrace(const char* path) const;
+
+    static const char* GetZoneName(ProfileZone zone);
+    static uint64_t NowNs();
+
+private:
+    struct Event {
+        uint64_t startNs;
+        uint64_t durationNs;
+        uint32_t threadId;
+        uint8_t zone;            // ProfileZone；Count 表示整幀
+    };
+
+    struct FrameRecord {
+        double frameMs;                  // 幀間隔
+        double zoneMs[ZONE_COUNT];       // 各區段總和
+    };
+
+    std::vector<Event> events_;
+    std::atomic<uint64_t> eventCursor_;              // 下一個寫入位置（遞增不回繞）
+    std::atomic<uint64_t> zoneNs_[ZONE_COUNT];       // 本幀各區段累計
+    std::vector<FrameRecord> frames_;
+    uint64_t frameCount_;                            // 已完成的幀數
+    uint64_t frameStartNs_;
+    uint64_t originNs_;                              // trace 時間起點
+
+    void PushEvent(uint8_t zone, uint64_t startNs, uint64_t endNs);
+    ZoneStats ComputeStats(int zone) const;          // zone < 0 表示整幀
+    static uint32_t CurrentThreadId();
+};
+
+// ============================================================================
+// 區段計時（RAII）；profiler 為空時不做任何事
+// ============================================================================
+class ProfileScope {
+private:
+    Profiler* profiler_;
+    ProfileZone zone_;
+    uint64_t startNs_;
+
+public:
+    ProfileScope(Profiler* profiler, ProfileZone zone)
+        : profiler_(profiler), zone_(zone), startNs_(profiler ? Profiler::NowNs() : 0) {}
+
+    ~ProfileScope() {
+        if (profiler_) profiler_->Record(zone_, startNs_, Profiler::NowNs());
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+};
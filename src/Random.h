@@ -0,0 +1,66 @@
+#pragma once
+#include <cstdint>
+
+// ============================================================================
+// 亂數產生器（xoshiro256**）
+// 以 splitmix64 由 (種子, 串流編號) 展開初始狀態；不同串流互不相關，
+// 各子系統與各執行緒使用自己的串流，結果只取決於種子
+// ============================================================================
+class Random {
+private:
+    uint64_t state_[4];
+
+    static uint64_t Rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+public:
+    explicit Random(uint64_t seed = 1, uint64_t stream = 0) { Seed(seed, stream); }
+
+    // splitmix64：用於展開種子
+    static uint64_t SplitMix64(uint64_t& state) {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    void Seed(uint64_t seed, uint64_t stream = 0) {
+        // 先打散串流編號再與種子混合，避免相鄰串流的初始狀態互相重疊
+        uint64_t streamKey = stream;
+        uint64_t state = seed ^ SplitMix64(streamKey);
+        for (uint64_t& word : state_) {
+            word = SplitMix64(state);
+        }
+    }
+
+    uint64_t Next() {
+        const uint64_t result = Rotl(state_[1] * 5, 7) * 9;
+        const uint64_t t = state_[1] << 17;
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = Rotl(state_[3], 45);
+        return result;
+    }
+
+    uint32_t NextU32() { return (uint32_t)(Next() >> 32); }
+
+    // [0, bound)
+    int NextInt(int bound) { return (int)(((uint64_t)NextU32() * (uint32_t)bound) >> 32); }
+
+    // [low, high]
+    int Range(int low, int high) { return low + NextInt(high - low + 1); }
+
+    // [0, 1)
+    float NextFloat() { return (float)(Next() >> 40) * (1.0f / 16777216.0f); }
+};
+
+// ============================================================================
+// 模擬核心使用的亂數串流
+// ============================================================================
+enum class RandomStream {
+    Spawn,      // 怪獸生成位置與等級
+    AI,         // 怪獸漫遊（再依更新區塊分流）
+    Count
+};
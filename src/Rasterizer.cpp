@@ -0,0 +1,200 @@
+#include "Rasterizer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+Rasterizer::Rasterizer()
+    : pixels_(nullptr)
+    , width_(0)
+    , height_(0)
+    , pitch_(0)
+    , simdLevel_(GetHostSimdLevel())
+    , kernels_(&GetSpanKernels(simdLevel_))
+{
+}
+
+// ============================================================================
+// 表面
+// ============================================================================
+void Rasterizer::Allocate(int width, int height) {
+    width_ = std::max(0, width);
+    height_ = std::max(0, height);
+    pitch_ = width_;
+    storage_.assign((size_t)width_ * height_, 0);
+    pixels_ = storage_.empty() ? nullptr : storage_.data();
+}
+
+void Rasterizer::Attach(uint32_t* pixels, int width, int height, int pitch) {
+    std::vector<uint32_t>().swap(storage_);
+    pixels_ = pixels;
+    width_ = pixels ? width : 0;
+    height_ = pixels ? height : 0;
+    pitch_ = pixels ? pitch : 0;
+}
+
+void Rasterizer::Detach() {
+    Attach(nullptr, 0, 0, 0);
+}
+
+void Rasterizer::SetSimdLevel(SimdLevel level) {
+    simdLevel_ = ClampSimdLevel(level);
+    kernels_ = &GetSpanKernels(simdLevel_);
+}
+
+// ============================================================================
+// 圖元
+// ============================================================================
+
+// 單列填色：[left, right)，裁切後交給核心
+void Rasterizer::FillSpan(int y, int left, int right, uint32_t pixel) {
+    if (y < 0 || y >= height_) return;
+    left = std::max(left, 0);
+    right = std::min(right, width_);
+    if (left >= right) return;
+    kernels_->fill(pixels_ + (size_t)y * pitch_ + left, right - left, pixel);
+}
+
+void Rasterizer::Clear(uint32_t pixel) {
+    FillRect(0, 0, width_, height_, pixel);
+}
+
+void Rasterizer::FillRect(int left, int top, int right, int bottom, uint32_t pixel) {
+    left = std::max(left, 0);
+    top = std::max(top, 0);
+    right = std::min(right, width_);
+    bottom = std::min(bottom, height_);
+    if (left >= right || top >= bottom) return;
+
+    uint32_t* row = pixels_ + (size_t)top * pitch_ + left;
+    for (int y = top; y < bottom; y++, row += pitch_) {
+        kernels_->fill(row, right - left, pixel);
+    }
+}
+
+void Rasterizer::FillEllipse(int left, int top, int right, int bottom, uint32_t pixel) {
+    if (right <= left || bottom <= top) return;
+
+    float centerX = (left + right) * 0.5f;
+    float centerY = (top + bottom) * 0.5f;
+    float radiusX = (right - left) * 0.5f;
+    float radiusY = (bottom - top) * 0.5f;
+
+    // 以像素中心取樣，每列一段
+    int firstRow = std::max(top, 0);
+    int lastRow = std::min(bottom, height_);
+    for (int y = firstRow; y < lastRow; y++) {
+        float dy = (y + 0.5f - centerY) / radiusY;
+        float remaining = 1.0f - dy * dy;
+        if (remaining <= 0) continue;
+
+        float half = radiusX * std::sqrt(remaining);
+        FillSpan(y, (int)std::lround(centerX - half), (int)std::lround(centerX + half), pixel);
+    }
+}
+
+void Rasterizer::FillPolygon(const RasterPoint* points, int count, uint32_t pixel) {
+    if (count < 3 || count > MAX_POLYGON_POINTS) return;
+
+    int minY = points[0].y;
+    int maxY = points[0].y;
+    for (int i = 1; i < count; i++) {
+        minY = std::min(minY, points[i].y);
+        maxY = std::max(maxY, points[i].y);
+    }
+    minY = std::max(minY, 0);
+    maxY = std::min(maxY, height_);
+
+    // 掃描線：以像素中心與各邊求交點，依奇偶規則兩兩成段
+    float crossings[MAX_POLYGON_POINTS];
+    for (int y = minY; y < maxY; y++) {
+        float sampleY = y + 0.5f;
+        int crossingCount = 0;
+        for (int i = 0; i < count; i++) {
+            const RasterPoint& a = points[i];
+            const RasterPoint& b = points[(i + 1) % count];
+            if ((a.y <= sampleY) == (b.y <= sampleY)) continue;
+
+            float t = (sampleY - a.y) / (float)(b.y - a.y);
+            crossings[crossingCount++] = a.x + t * (b.x - a.x);
+        }
+        std::sort(crossings, crossings + crossingCount);
+        for (int i = 0; i + 1 < crossingCount; i += 2) {
+            FillSpan(y, (int)std::ceil(crossings[i] - 0.5f), (int)std::ceil(crossings[i + 1] - 0.5f), pixel);
+        }
+    }
+}
+
+// 以 size x size 的方塊當筆刷
+void Rasterizer::Stamp(int x, int y, int size, uint32_t pixel) {
+    int offset = size / 2;
+    FillRect(x - offset, y - offset, x - offset + size, y - offset + size, pixel);
+}
+
+void Rasterizer::DrawLine(int x0, int y0, int x1, int y1, int width, uint32_t pixel) {
+    int size = std::max(1, width);
+
+    // 水平線直接交給填色核心
+    if (y0 == y1) {
+        int offset = size / 2;
+        FillRect(std::min(x0, x1) - offset, y0 - offset, std::max(x0, x1) - offset + size, y0 - offset + size, pixel);
+        return;
+    }
+
+    // Bresenham
+    int dx = std::abs(x1 - x0);
+    int dy = -std::abs(y1 - y0);
+    int stepX = x0 < x1 ? 1 : -1;
+    int stepY = y0 < y1 ? 1 : -1;
+    int error = dx + dy;
+    while (true) {
+        Stamp(x0, y0, size, pixel);
+        if (x0 == x1 && y0 == y1) break;
+
+        int doubled = 2 * error;
+        if (doubled >= dy) {
+            error += dy;
+            x0 += stepX;
+        }
+        if (doubled <= dx) {
+            error += dx;
+            y0 += stepY;
+        }
+    }
+}
+
+void Rasterizer::DrawPolygonOutline(const RasterPoint* points, int count, uint32_t pixel) {
+    for (int i = 0; i < count; i++) {
+        const RasterPoint& a = points[i];
+        const RasterPoint& b = points[(i + 1) % count];
+        DrawLine(a.x, a.y, b.x, b.y, 1, pixel);
+    }
+}
+
+// ============================================================================
+// 貼圖
+// ============================================================================
+void Rasterizer::Blit(const Rasterizer& source, int sourceX, int sourceY, int width, int height, int x, int y) {
+    // 裁切到目標範圍
+    if (x < 0) { sourceX -= x; width += x; x = 0; }
+    if (y < 0) { sourceY -= y; height += y; y = 0; }
+    width = std::min(width, width_ - x);
+    height = std::min(height, height_ - y);
+    if (width <= 0 || height <= 0) return;
+
+    for (int row = 0; row < height; row++) {
+        kernels_->copy(pixels_ + (size_t)(y + row) * pitch_ + x, source.GetRow(sourceY + row) + sourceX, width);
+    }
+}
+
+void Rasterizer::BlitKeyed(const Rasterizer& source, int sourceX, int sourceY, int width, int height,
+                           int x, int y, uint32_t key) {
+    if (x < 0) { sourceX -= x; width += x; x = 0; }
+    if (y < 0) { sourceY -= y; height += y; y = 0; }
+    width = std::min(width, width_ - x);
+    height = std::min(height, height_ - y);
+    if (width <= 0 || height <= 0) return;
+
+    for (int row = 0; row < height; row++) {
+        kernels_->copyKeyed(pixels_ + (size_t)(y + row) * pitch_ + x, source.GetRow(sourceY + row) + sourceX, width, key);
+    }
+}
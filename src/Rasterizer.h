@@ -0,0 +1,73 @@
+#pragma once
+#include "SpanKernels.h"
+#include "Types.h"
+#include <cstdint>
+#include <vector>
+
+// ============================================================================
+// 軟體繪圖表面
+// 直接在 CPU 像素緩衝區上填色、畫線與貼圖，所有圖元都拆成水平像素列交給 SpanKernels；
+// 緩衝區可自行配置（無視窗環境），也可掛上外部記憶體（Windows 的 DIB section）
+// 像素格式為 0x00RRGGBB，由上而下排列；所有圖元都會裁切到表面範圍內
+// ============================================================================
+struct RasterPoint {
+    int x;
+    int y;
+};
+
+class Rasterizer {
+private:
+    std::vector<uint32_t> storage_;      // 自行配置時的緩衝區
+    uint32_t* pixels_;
+    int width_;
+    int height_;
+    int pitch_;                          // 每列的像素數（>= width）
+    SimdLevel simdLevel_;
+    const SpanKernels* kernels_;
+
+    void FillSpan(int y, int left, int right, uint32_t pixel);
+    void Stamp(int x, int y, int size, uint32_t pixel);
+
+public:
+    static constexpr int MAX_POLYGON_POINTS = 16;
+
+    Rasterizer();
+
+    Rasterizer(const Rasterizer&) = delete;
+    Rasterizer& operator=(const Rasterizer&) = delete;
+
+    // 表面
+    void Allocate(int width, int height);
+    void Attach(uint32_t* pixels, int width, int height, int pitch);
+    void Detach();
+    void SetSimdLevel(SimdLevel level);
+
+    // Color（0x00BBGGRR）轉成像素格式
+    static uint32_t ToPixel(Color color) {
+        return ((color & 0xFF) << 16) | (color & 0xFF00) | ((color >> 16) & 0xFF);
+    }
+
+    // 圖元（矩形與橢圓以外接框表示，右下角不含，與 GDI 相同）
+    void Clear(uint32_t pixel);
+    void FillRect(int left, int top, int right, int bottom, uint32_t pixel);
+    void FillEllipse(int left, int top, int right, int bottom, uint32_t pixel);
+    void FillPolygon(const RasterPoint* points, int count, uint32_t pixel);
+    void DrawLine(int x0, int y0, int x1, int y1, int width, uint32_t pixel);
+    void DrawPolygonOutline(const RasterPoint* points, int count, uint32_t pixel);
+
+    // 貼圖：把 source 的 (sourceX, sourceY, width, height) 貼到 (x, y)
+    void Blit(const Rasterizer& source, int sourceX, int sourceY, int width, int height, int x, int y);
+    void BlitKeyed(const Rasterizer& source, int sourceX, int sourceY, int width, int height,
+                   int x, int y, uint32_t key);
+
+    // 存取方法
+    bool IsReady() const { return pixels_ != nullptr; }
+    uint32_t* GetPixels() { return pixels_; }
+    const uint32_t* GetPixels() const { return pixels_; }
+    const uint32_t* GetRow(int y) const { return pixels_ + (size_t)y * pitch_; }
+    uint32_t GetPixel(int x, int y) const { return pixels_[(size_t)y * pitch_ + x]; }
+    int GetWidth() const { return width_; }
+    int GetHeight() const { return height_; }
+    int GetPitch() const { return pitch_; }
+    SimdLevel GetSimdLevel() const { return simdLevel_; }
+};
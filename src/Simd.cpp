@@ -0,0 +1,50 @@
+#include "Simd.h"
+
+#if defined(HEROWAR_X86) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace {
+
+SimdLevel DetectSimdLevel() {
+#if defined(HEROWAR_X86) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return SimdLevel::SSE2;
+
+    // AVX2 需要 CPU 支援，且作業系統會保存 YMM 暫存器（OSXSAVE + XCR0）
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) return SimdLevel::SSE2;
+
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) ? SimdLevel::AVX2 : SimdLevel::SSE2;
+#elif defined(HEROWAR_X86)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") ? SimdLevel::AVX2 : SimdLevel::SSE2;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+}
+
+SimdLevel GetHostSimdLevel() {
+    static const SimdLevel level = DetectSimdLevel();
+    return level;
+}
+
+SimdLevel ClampSimdLevel(SimdLevel level) {
+    SimdLevel host = GetHostSimdLevel();
+    return (int)level > (int)host ? host : level;
+}
+
+const char* GetSimdLevelName(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::Scalar: return "scalar";
+        case SimdLevel::SSE2: return "SSE2";
+        case SimdLevel::AVX2: return "AVX2";
+        default: return "?";
+    }
+}
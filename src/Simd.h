@@ -0,0 +1,32 @@
+#pragma once
+
+// ============================================================================
+// SIMD 指令集偵測
+// 核心以 SSE2 為基準（x64 一定支援），AVX2 在執行期偵測後才使用；
+// 非 x86 平台一律回退到純量版本
+// ============================================================================
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define HEROWAR_X86 1
+#endif
+
+// 讓 GCC / Clang 在未開啟 -mavx2 時也能為單一函式產生 AVX2 指令（MSVC 不需要）
+#if defined(HEROWAR_X86) && (defined(__GNUC__) || defined(__clang__))
+#define HEROWAR_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define HEROWAR_TARGET_AVX2
+#endif
+
+enum class SimdLevel {
+    Scalar,
+    SSE2,
+    AVX2,
+    Count
+};
+
+// 本機支援的最高等級（結果會快取）
+SimdLevel GetHostSimdLevel();
+
+// 不超過本機支援的等級
+SimdLevel ClampSimdLevel(SimdLevel level);
+
+const char* GetSimdLevelName(SimdLevel level);
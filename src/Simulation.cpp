@@ -0,0 +1,249 @@
+#include "Simulation.h"
+#include <algorithm>
+
+using namespace GameConstants;
+
+Simulation::Simulation(const Clock* clock)
+    : clock_(clock)
+    , profiler_(nullptr)
+    , jobs_(nullptr)
+    , content_(nullptr)
+    , hero_(Vector2D((float)MAP_WIDTH / 2, (float)MAP_HEIGHT / 2))
+    , monsters_(&monsterGrid_)
+    , gameState_(GameState::WeaponSelect)
+    , monsterCount_(INITIAL_MONSTER_COUNT)
+    , wave_(0)
+    , waveTimer_(0)
+{
+    spawnPlacer_.SetBounds(50.0f, 50.0f, (float)(MAP_WIDTH - 50), (float)(MAP_HEIGHT - 50));
+    monsters_.SetFlowField(&flowField_);
+    monsters_.SetLodEnabled(true);
+    SetContent(&ContentDatabase::GetDefault());
+    SetSeed(1);
+}
+
+void Simulation::SetContent(const ContentDatabase* content) {
+    content_ = content;
+    for (int level = 1; level <= MAX_MONSTER_LEVEL; level++) {
+        spawnPlacer_.SetLevelWeight(level, content_->GetSpawnWeight(level));
+        spawnPlacer_.SetLevelSpacing(level, content_->GetSpawnSpacing(level));
+    }
+}
+
+void Simulation::SetSimdLevel(SimdLevel level) {
+    combat_.SetSimdLevel(level);
+    collisions_.SetSimdLevel(level);
+}
+
+void Simulation::SetSeed(uint64_t seed) {
+    seed_ = seed;
+    for (int i = 0; i < (int)RandomStream::Count; i++) {
+        streams_[i].Seed(seed, (uint64_t)i);
+    }
+}
+
+void Simulation::Reset() {
+    hero_.Reset(Vector2D((float)MAP_WIDTH / 2, (float)MAP_HEIGHT / 2));
+    flowField_.Invalidate();
+    InitializeMonsters();
+    SetState(GameState::WeaponSelect);
+}
+
+// 狀態有變化時才發布事件
+void Simulation::SetState(GameState state) {
+    if (state == gameState_) return;
+    
+    events_.Publish(GameEvent::MakeStateChanged(gameState_, state));
+    gameState_ = state;
+}
+
+void Simulation::InitializeMonsters() {
+    // 容量不變時 Reserve 只重設空閒清單，重新開局不會配置記憶體
+    monsters_.Reserve(monsterCount_);
+    combat_.Reserve(monsterCount_);
+    collisions_.Reserve(monsterCount_);
+    spawnPoints_.reserve(monsterCount_);
+    monsters_.SetSeed(GetRandom(RandomStream::AI).Next());
+    
+    // 間距依容量與可用面積推算，讓一整波怪獸平均散布在地圖上
+    float area = (float)(MAP_WIDTH - 100) * (MAP_HEIGHT - 100) - 3.14159265f * SPAWN_SAFE_RADIUS * SPAWN_SAFE_RADIUS;
+    float spacing = SpawnPlacer::FitSpacing(area, monsterCount_);
+    if (spacing != spawnPlacer_.GetMinSpacing()) {
+        spawnPlacer_.SetMinSpacing(spacing);
+    }
+    
+    wave_ = 0;
+    SpawnWave();
+}
+
+void Simulation::SpawnWave() {
+    wave_++;
+    waveTimer_ = WAVE_INTERVAL;
+    
+    int count = monsters_.GetFreeCount();
+    if (count == 0) return;
+    
+    // 補滿所有空槽：避開英雄周圍與現存怪獸，後面的波次等級逐步提高
+    spawnPlacer_.Begin();
+    spawnPlacer_.AddExclusion(hero_.GetPosition(), SPAWN_SAFE_RADIUS);
+    const int* activeIds = monsters_.GetActiveIds();
+    for (int i = 0; i < monsters_.GetAliveCount(); i++) {
+        int id = activeIds[i];
+        spawnPlacer_.AddOccupied(monsters_.GetPosition(id), monsters_.GetLevel(id));
+    }
+    
+    spawnPoints_.clear();
+    spawnPlacer_.Generate(count, GetRandom(RandomStream::Spawn), spawnPoints_);
+    
+    int levelBonus = (wave_ - 1) / 2;
+    for (const SpawnPoint& point : spawnPoints_) {
+        monsters_.Spawn(point.pos, std::min(MAX_MONSTER_LEVEL, point.level + levelBonus));
+    }
+}
+
+void Simulation::UpdateWaves(float deltaTime) {
+    if (wave_ >= WAVE_COUNT) return;
+    
+    waveTimer_ -= deltaTime;
+    if (waveTimer_ <= 0 || monsters_.GetPopulation().alive == 0) {
+        SpawnWave();
+    }
+}
+
+void Simulation::SelectWeapon(int index) {
+    if (index < 0 || index >= content_->GetWeaponCount()) return;
+    
+    hero_.SetWeapon(content_->GetWeapon(index));
+    SetState(GameState::Playing);
+}
+
+void Simulation::Tick(const InputSnapshot& input, float deltaTime) {
+    switch (gameState_) {
+        case GameState::WeaponSelect:
+            // 按鍵 1~9 對應內容檔中的前九把武器
+            for (int i = 0; i < std::min(9, content_->GetWeaponCount()); i++) {
+                if (input.IsPressed('1' + i)) {
+                    SelectWeapon(i);
+                    break;
+                }
+            }
+            break;
+            
+        case GameState::Playing:
+            hero_.StorePreviousPosition();
+            monsters_.StorePreviousPositions();
+            UpdatePlaying(input, deltaTime);
+            break;
+            
+        case GameState::GameOver:
+        case GameState::Victory:
+            if (input.IsPressed(KeyCodes::SPACE) || input.IsPressed(KeyCodes::ENTER)) {
+                Reset();
+            }
+            break;
+    }
+}
+
+void Simulation::UpdatePlaying(const InputSnapshot& input, float deltaTime) {
+    {
+        ProfileScope scope(profiler_, ProfileZone::Input);
+        if (input.IsPressed(KeyCodes::UP) || input.IsPressed('W')) {
+            hero_.Move(Direction::Up);
+        }
+        if (input.IsPressed(KeyCodes::DOWN) || input.IsPressed('S')) {
+            hero_.Move(Direction::Down);
+        }
+        if (input.IsPressed(KeyCodes::LEFT)) {
+            hero_.Move(Direction::Left);
+        }
+        if (input.IsPressed(KeyCodes::RIGHT) || input.IsPressed('D')) {
+            hero_.Move(Direction::Right);
+        }
+    }
+    
+    if (input.IsPressed('A')) {
+        ProfileScope scope(profiler_, ProfileZone::Attack);
+        CheckAttack();
+    } else {
+        hero_.EndAttack();
+    }
+    
+    {
+        ProfileScope scope(profiler_, ProfileZone::MonsterUpdate);
+        // 英雄換格時才重建流場；LOD 以畫面中心為準：靠近地圖邊緣時攝影機被夾住，
+        // 畫面中心不在英雄身上，以英雄為中心會讓畫面內的怪獸落到中距離
+        float heroHalf = hero_.GetSize() * 0.5f;
+        Vector2D heroCenter = hero_.GetPosition() + Vector2D(heroHalf, heroHalf);
+        flowField_.SetTarget(heroCenter);
+        Vector2D camera = ComputeCameraOffset(hero_.GetPosition());
+        monsters_.SetLodFocus(camera + Vector2D(WINDOW_WIDTH * 0.5f, WINDOW_HEIGHT * 0.5f));
+        monsters_.Update(deltaTime, jobs_);
+    }
+    
+    {
+        ProfileScope scope(profiler_, ProfileZone::Collision);
+        collisions_.Resolve(monsters_, hero_, jobs_);
+    }
+    ApplyMeleeDamage();
+    
+    UpdateWaves(deltaTime);
+    CheckGameOver();
+}
+
+void Simulation::CheckAttack() {
+    uint32_t currentTime = clock_->NowMs();
+    if (!hero_.CanAttack(currentTime)) return;
+    
+    int damage = hero_.PerformAttack(currentTime);
+    
+    // 依武器的判定範圍與英雄面向收集目標，由近到遠一次結算
+    const WeaponStats& weapon = hero_.GetWeapon();
+    float heroHalf = hero_.GetSize() * 0.5f;
+    HitArea area = HitArea::FromWeapon(weapon, hero_.GetPosition() + Vector2D(heroHalf, heroHalf), hero_.GetFacing());
+    if (combat_.Collect(monsterGrid_, area, weapon.maxTargets) == 0) return;
+    
+    const CombatStats& result = combat_.Apply(monsters_, damage, &events_);
+    
+    // 英雄的經驗與擊殺數在這一步內直接結算，不等畫面端取出 MonsterKilled：
+    // 事件每幀才取出一次，步數與幀數的比例隨機器而變，等級影響下一步的攻擊力，延後結算會讓重播分歧；
+    // 事件匯流排只給畫面端（HUD、統計、特效）消費，升級事件由等級變化推得
+    if (result.kills > 0) {
+        int previousLevel = hero_.GetLevel();
+        hero_.GainExperience(result.experience);
+        hero_.AddKills(result.kills);
+        for (int level = previousLevel + 1; level <= hero_.GetLevel(); level++) {
+            events_.Publish(GameEvent::MakeLevelUp(level));
+        }
+    }
+}
+
+// 與英雄接觸的怪獸各自依冷卻出手
+void Simulation::ApplyMeleeDamage() {
+    for (int id : collisions_.GetHeroContacts()) {
+        int damage = monsters_.Strike(id);
+        if (damage > 0) {
+            int hpBefore = hero_.GetCurrentHp();
+            hero_.TakeDamage(damage);
+            events_.Publish(GameEvent::MakeDamageDealt(id, hpBefore - hero_.GetCurrentHp(), hero_.GetCurrentHp(), true,
+                                                       monsters_.GetPosition(id)));
+        }
+    }
+}
+
+void Simulation::CheckGameOver() {
+    if (!hero_.IsAlive()) {
+        SetState(GameState::GameOver);
+        return;
+    }
+    
+    if (wave_ >= WAVE_COUNT && monsters_.GetPopulation().alive == 0) {
+        SetState(GameState::Victory);
+    }
+}
+
+Vector2D Simulation::ComputeCameraOffset(Vector2D heroPos) {
+    Vector2D offset(heroPos.x - WINDOW_WIDTH / 2.0f, heroPos.y - WINDOW_HEIGHT / 2.0f);
+    offset.x = std::max(0.0f, std::min(offset.x, (float)(MAP_WIDTH - WINDOW_WIDTH)));
+    offset.y = std::max(0.0f, std::min(offset.y, (float)(MAP_HEIGHT - WINDOW_HEIGHT)));
+    return offset;
+}
@@ -0,0 +1,104 @@
+#pragma once
+#include "Character.h"
+#include "Clock.h"
+#include "CollisionSystem.h"
+#include "CombatResolver.h"
+#include "ContentDatabase.h"
+#include "EventBus.h"
+#include "FlowField.h"
+#include "JobSystem.h"
+#include "MonsterPool.h"
+#include "Profiler.h"
+#include "Random.h"
+#include "SpatialGrid.h"
+#include "SpawnPlacer.h"
+#include <cstring>
+#include <vector>
+
+// ============================================================================
+// 輸入快照：某一刻的按鍵狀態
+// ============================================================================
+struct InputSnapshot {
+    bool keys[256];
+
+    InputSnapshot() { std::memset(keys, 0, sizeof(keys)); }
+
+    bool IsPressed(int key) const { return key >= 0 && key < 256 && keys[key]; }
+    void SetKey(int key, bool pressed) { if (key >= 0 && key < 256) keys[key] = pressed; }
+};
+
+// ============================================================================
+// 模擬核心
+// 與平台無關的遊戲邏輯；時間由注入的時鐘提供，輸入由快照提供
+// ============================================================================
+class Simulation {
+private:
+    const Clock* clock_;                 // 注入的時鐘
+    Profiler* profiler_;                 // 注入的效能分析器（可為空）
+    JobSystem* jobs_;                    // 注入的工作排程器（可為空，為空時單執行緒更新）
+    const ContentDatabase* content_;     // 武器與怪獸等級表（預設為內建內容）
+    Hero hero_;                          // 重新開局時就地重設，不重新配置
+    SpatialGrid monsterGrid_;            // 存活怪獸的空間索引（ID 為怪獸池索引）
+    MonsterPool monsters_;               // 怪獸資料（SoA）
+    GameState gameState_;
+    int monsterCount_;                   // 怪獸池容量（每波補滿空槽）
+    int wave_;                           // 目前波數（1 起算）
+    float waveTimer_;                    // 距離下一波的剩餘秒數
+    uint64_t seed_;                      // 亂數種子（相同種子與輸入可重現整段遊戲）
+    Random streams_[(int)RandomStream::Count];   // 各子系統的亂數串流
+    CombatResolver combat_;              // 英雄攻擊的範圍判定
+    CollisionSystem collisions_;         // 怪獸之間與英雄的碰撞分離
+    FlowField flowField_;                // 朝英雄的追擊流場（所有怪獸共用）
+    SpawnPlacer spawnPlacer_;            // 生成位置配置（藍噪聲取樣）
+    std::vector<SpawnPoint> spawnPoints_;    // 生成點暫存
+    EventBus events_;                    // 傷害、擊殺、升級與狀態切換（畫面端每幀取出）
+
+    void SpawnWave();
+    void SetState(GameState state);
+
+public:
+    explicit Simulation(const Clock* clock);
+
+    // 初始化
+    void Reset();
+    void InitializeMonsters();
+    void SelectWeapon(int index);
+    void SetMonsterCount(int count) { monsterCount_ = count; }
+    int GetMonsterCount() const { return monsterCount_; }
+    void SetProfiler(Profiler* profiler) { profiler_ = profiler; }
+    void SetJobSystem(JobSystem* jobs) { jobs_ = jobs; }
+    void SetContent(const ContentDatabase* content);
+    void SetSimdLevel(SimdLevel level);
+    void SetCollisionBudget(int testsPerTick) { collisions_.SetBudget(testsPerTick); }
+    void SetLodEnabled(bool enabled) { monsters_.SetLodEnabled(enabled); }
+    const ContentDatabase& GetContent() const { return *content_; }
+    void SetSeed(uint64_t seed);
+    uint64_t GetSeed() const { return seed_; }
+    Random& GetRandom(RandomStream stream) { return streams_[(int)stream]; }
+
+    // 推進一個模擬步（deltaTime 通常為 FIXED_TIMESTEP）
+    void Tick(const InputSnapshot& input, float deltaTime);
+
+    // 遊戲邏輯
+    void UpdatePlaying(const InputSnapshot& input, float deltaTime);
+    void UpdateWaves(float deltaTime);
+    void CheckAttack();
+    void ApplyMeleeDamage();
+    void CheckGameOver();
+
+    // 攝影機左上角：以英雄位置（左上角）置中並夾在地圖內；畫面與怪獸 LOD 共用同一個算法
+    static Vector2D ComputeCameraOffset(Vector2D heroPos);
+
+    // 存取方法
+    GameState GetState() const { return gameState_; }
+    const Hero& GetHero() const { return hero_; }
+    int GetWave() const { return wave_; }
+    MonsterPool& GetMonsters() { return monsters_; }
+    const MonsterPool& GetMonsters() const { return monsters_; }
+    const SpatialGrid& GetMonsterGrid() const { return monsterGrid_; }
+    const CollisionStats& GetCollisionStats() const { return collisions_.GetStats(); }
+    const CollisionSystem& GetCollisions() const { return collisions_; }
+    const CombatStats& GetCombatStats() const { return combat_.GetStats(); }
+    const FlowField& GetFlowField() const { return flowField_; }
+    EventBus& GetEvents() { return events_; }
+};
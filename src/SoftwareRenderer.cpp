@@ -0,0 +1,308 @@
+#include "SoftwareRenderer.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+using namespace GameConstants;
+
+namespace {
+
+const uint32_t OUTLINE = Rasterizer::ToPixel(MakeColor(0, 0, 0));
+const uint32_t BACKDROP = Rasterizer::ToPixel(MakeColor(40, 40, 50));
+const uint32_t GRASS_LIGHT = Rasterizer::ToPixel(MakeColor(50, 120, 50));
+const uint32_t GRASS_DARK = Rasterizer::ToPixel(MakeColor(45, 110, 45));
+const uint32_t MAP_BORDER = Rasterizer::ToPixel(MakeColor(100, 50, 0));
+const uint32_t BAR_BACKGROUND = Rasterizer::ToPixel(MakeColor(60, 60, 60));
+
+}
+
+SoftwareRenderer::SoftwareRenderer()
+    : content_(&ContentDatabase::GetDefault())
+    , weaponVariants_(0)
+    , culledCount_(0)
+    , spriteBuildMs_(0)
+{
+}
+
+// ============================================================================
+// 精靈表
+// ============================================================================
+int SoftwareRenderer::MonsterCell(int level) {
+    return (level >= 1 && level < MONSTER_VARIANTS) ? level : 0;
+}
+
+int SoftwareRenderer::HeroCell(Direction facing, int weaponIndex) {
+    return MONSTER_VARIANTS + (weaponIndex + 1) * FACING_VARIANTS + (int)facing;
+}
+
+void SoftwareRenderer::BuildSprites() {
+    auto start = std::chrono::steady_clock::now();
+
+    weaponVariants_ = std::min(WEAPON_VARIANTS, content_->GetWeaponCount() + 1);
+    int cellCount = MONSTER_VARIANTS + FACING_VARIANTS * weaponVariants_;
+    sprites_.Allocate(CELL_SIZE, CELL_SIZE * cellCount);
+    sprites_.Clear(KEY_PIXEL);
+    bounds_.assign(cellCount, CellBounds());
+
+    for (int level = 0; level < MONSTER_VARIANTS; level++) {
+        DrawMonsterShape(sprites_, level, ANCHOR_X, MonsterCell(level) * CELL_SIZE + ANCHOR_Y);
+    }
+    for (int index = -1; index < weaponVariants_ - 1; index++) {
+        WeaponStats weapon = index >= 0 ? content_->GetWeapon(index) : WeaponStats();
+        for (int facing = 0; facing < FACING_VARIANTS; facing++) {
+            int cell = HeroCell((Direction)facing, index);
+            DrawHeroShape(sprites_, (Direction)facing, weapon, ANCHOR_X, cell * CELL_SIZE + ANCHOR_Y);
+        }
+    }
+    for (int cell = 0; cell < cellCount; cell++) {
+        ComputeBounds(cell);
+    }
+
+    spriteBuildMs_ = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+// 只貼含有不透明像素的範圍，省去格子四周的空白
+void SoftwareRenderer::ComputeBounds(int cell) {
+    CellBounds bounds = { CELL_SIZE, CELL_SIZE, 0, 0 };
+    for (int y = 0; y < CELL_SIZE; y++) {
+        const uint32_t* row = sprites_.GetRow(cell * CELL_SIZE + y);
+        for (int x = 0; x < CELL_SIZE; x++) {
+            if (row[x] == KEY_PIXEL) continue;
+            bounds.left = std::min(bounds.left, x);
+            bounds.right = std::max(bounds.right, x + 1);
+            bounds.top = std::min(bounds.top, y);
+            bounds.bottom = std::max(bounds.bottom, y + 1);
+        }
+    }
+    bounds_[cell] = bounds;
+}
+
+void SoftwareRenderer::DrawSprite(Rasterizer& target, int cell, int x, int y) const {
+    const CellBounds& bounds = bounds_[cell];
+    target.BlitKeyed(sprites_, bounds.left, cell * CELL_SIZE + bounds.top,
+                     bounds.right - bounds.left, bounds.bottom - bounds.top,
+                     x - ANCHOR_X + bounds.left, y - ANCHOR_Y + bounds.top, KEY_PIXEL);
+}
+
+// ============================================================================
+// 背景
+// ============================================================================
+void SoftwareRenderer::DrawBackground(Rasterizer& target, Vector2D camera) {
+    int cameraX = (int)camera.x;
+    int cameraY = (int)camera.y;
+    int width = target.GetWidth();
+    int height = target.GetHeight();
+    if (tileRow_.GetWidth() != width) {
+        tileRow_.Allocate(width, 2);
+    }
+    tileRow_.SetSimdLevel(target.GetSimdLevel());
+
+    // 預先畫好兩種相位的地磚列（第 0 列與第 1 列的明暗相反），每條掃描線整段複製
+    int mapLeft = std::max(0, -cameraX);
+    int mapRight = std::min(width, MAP_WIDTH - cameraX);
+    for (int phase = 0; phase < 2; phase++) {
+        tileRow_.FillRect(0, phase, width, phase + 1, BACKDROP);
+        for (int tileX = (cameraX + mapLeft) / TILE_SIZE * TILE_SIZE; tileX - cameraX < mapRight; tileX += TILE_SIZE) {
+            uint32_t pixel = ((tileX / TILE_SIZE + phase) % 2 == 0) ? GRASS_LIGHT : GRASS_DARK;
+            tileRow_.FillRect(std::max(tileX - cameraX, mapLeft), phase,
+                              std::min(tileX + TILE_SIZE - cameraX, mapRight), phase + 1, pixel);
+        }
+    }
+
+    for (int y = 0; y < height; y++) {
+        int mapY = cameraY + y;
+        if (mapY < 0 || mapY >= MAP_HEIGHT) {
+            target.FillRect(0, y, width, y + 1, BACKDROP);
+        } else {
+            target.Blit(tileRow_, 0, (mapY / TILE_SIZE) % 2, width, 1, 0, y);
+        }
+    }
+
+    // 地圖邊框（寬 3，與 GDI 版本的 Rectangle 相同，以邊界為中心）
+    int left = -cameraX;
+    int top = -cameraY;
+    int right = MAP_WIDTH - cameraX;
+    int bottom = MAP_HEIGHT - cameraY;
+    target.FillRect(left - 1, top - 1, right + 2, top + 2, MAP_BORDER);
+    target.FillRect(left - 1, bottom - 2, right + 2, bottom + 1, MAP_BORDER);
+    target.FillRect(left - 1, top - 1, left + 2, bottom + 1, MAP_BORDER);
+    target.FillRect(right - 2, top - 1, right + 1, bottom + 1, MAP_BORDER);
+}
+
+// ============================================================================
+// 角色
+// ============================================================================
+void SoftwareRenderer::DrawMonsters(Rasterizer& target, const Simulation& simulation, Vector2D camera, float alpha) {
+    if (bounds_.empty()) BuildSprites();
+    const MonsterPool& monsters = simulation.GetMonsters();
+
+    // 與 GDI 路徑相同：只畫視野內的怪獸，依 ID 排序維持固定的繪製順序
+    visible_.clear();
+    simulation.GetMonsterGrid().QueryRect(
+        camera.x - CULL_MARGIN, camera.y - CULL_MARGIN,
+        camera.x + target.GetWidth() + CULL_MARGIN, camera.y + target.GetHeight() + CULL_MARGIN,
+        visible_);
+    std::sort(visible_.begin(), visible_.end());
+    culledCount_ = monsters.GetAliveCount() - (int)visible_.size();
+
+    const uint32_t barPixel = Rasterizer::ToPixel(MakeColor(200, 0, 0));
+    for (int id : visible_) {
+        Vector2D position = monsters.GetInterpolatedPosition(id, alpha);
+        int screenX = (int)(position.x - camera.x);
+        int screenY = (int)(position.y - camera.y);
+        int level = monsters.GetLevel(id);
+        DrawSprite(target, MonsterCell(level), screenX, screenY);
+
+        // 血條（位置與 EntityRenderer::DrawMonsterStatus 相同）
+        int barWidth = 40;
+        int barY = screenY - MONSTER_SIZE / 2 - 13;
+        float hpRatio = (float)monsters.GetCurrentHp(id) / MonsterPool::MaxHpForLevel(level);
+        target.FillRect(screenX - barWidth / 2, barY, screenX + barWidth / 2, barY + 4, BAR_BACKGROUND);
+        target.FillRect(screenX - barWidth / 2, barY, screenX - barWidth / 2 + (int)(barWidth * hpRatio), barY + 4, barPixel);
+    }
+}
+
+void SoftwareRenderer::DrawHero(Rasterizer& target, const Hero& hero, Vector2D camera, float alpha) const {
+    if (!hero.IsAlive()) return;
+
+    Vector2D position = hero.GetInterpolatedPosition(alpha);
+    int screenX = (int)(position.x - camera.x);
+    int screenY = (int)(position.y - camera.y);
+
+    const WeaponStats& weapon = hero.GetWeapon();
+    if (weapon.index < weaponVariants_ - 1) {
+        DrawSprite(target, HeroCell(hero.GetFacing(), weapon.index), screenX, screenY);
+    } else {
+        DrawHeroShape(target, hero.GetFacing(), weapon, screenX, screenY);
+    }
+
+    // 血條（位置與 EntityRenderer::DrawHeroStatus 相同）
+    int barWidth = 50;
+    int barY = screenY - hero.GetSize() / 2 - 20;
+    float hpRatio = (float)hero.GetCurrentHp() / hero.GetMaxHp();
+    Color hpColor = hpRatio > 0.5f ? MakeColor(0, 200, 0) :
+                    hpRatio > 0.25f ? MakeColor(255, 165, 0) : MakeColor(200, 0, 0);
+    target.FillRect(screenX - barWidth / 2, barY, screenX + barWidth / 2, barY + 6, BAR_BACKGROUND);
+    target.FillRect(screenX - barWidth / 2, barY, screenX - barWidth / 2 + (int)(barWidth * hpRatio), barY + 6,
+                    Rasterizer::ToPixel(hpColor));
+}
+
+void SoftwareRenderer::RenderScene(Rasterizer& target, const Simulation& simulation, Vector2D camera, float alpha) {
+    DrawBackground(target, camera);
+    DrawMonsters(target, simulation, camera, alpha);
+    DrawHero(target, simulation.GetHero(), camera, alpha);
+}
+
+// ============================================================================
+// 向量繪圖（外形與 EntityRenderer 相同；GDI 的預設畫筆是 1 像素黑框）
+// ============================================================================
+void SoftwareRenderer::DrawOutlinedEllipse(Rasterizer& target, int left, int top, int right, int bottom, uint32_t fill) {
+    target.FillEllipse(left, top, right, bottom, OUTLINE);
+    target.FillEllipse(left + 1, top + 1, right - 1, bottom - 1, fill);
+}
+
+void SoftwareRenderer::DrawOutlinedPolygon(Rasterizer& target, const RasterPoint* points, int count, uint32_t fill) {
+    target.FillPolygon(points, count, fill);
+    target.DrawPolygonOutline(points, count, OUTLINE);
+}
+
+void SoftwareRenderer::DrawHeroShape(Rasterizer& target, Direction facing, const WeaponStats& weapon, int x, int y) const {
+    int size = HERO_SIZE;
+    DrawOutlinedEllipse(target, x - size/2, y - size/2, x + size/2, y + size/2,
+                        Rasterizer::ToPixel(MakeColor(0, 100, 200)));
+
+    int headSize = size / 3;
+    DrawOutlinedEllipse(target, x - headSize, y - size/2 - headSize*2, x + headSize, y - size/2,
+                        Rasterizer::ToPixel(MakeColor(255, 220, 180)));
+
+    int eyeSize = 3;
+    int eyeOffset = headSize / 2;
+    int eyeX = x;
+    if (facing == Direction::Left) eyeX -= eyeOffset/2;
+    else if (facing == Direction::Right) eyeX += eyeOffset/2;
+    int eyeY = y - size/2 - headSize;
+    target.FillEllipse(eyeX - eyeOffset - eyeSize, eyeY - eyeSize, eyeX - eyeOffset + eyeSize, eyeY + eyeSize, OUTLINE);
+    target.FillEllipse(eyeX + eyeOffset - eyeSize, eyeY - eyeSize, eyeX + eyeOffset + eyeSize, eyeY + eyeSize, OUTLINE);
+
+    DrawWeapon(target, facing, weapon, x, y);
+}
+
+void SoftwareRenderer::DrawWeapon(Rasterizer& target, Direction facing, const WeaponStats& weapon, int x, int y) const {
+    if (weapon.type == WeaponType::None) return;
+
+    uint32_t weaponPixel = Rasterizer::ToPixel(weapon.color);
+    int weaponLength = 25;
+    int endX = x;
+    int endY = y;
+    switch (facing) {
+        case Direction::Up: endY = y - weaponLength; break;
+        case Direction::Down: endY = y + weaponLength; break;
+        case Direction::Left: endX = x - weaponLength; break;
+        case Direction::Right:
+        default: endX = x + weaponLength; break;
+    }
+    target.DrawLine(x, y, endX, endY, 3, weaponPixel);
+
+    bool horizontal = facing == Direction::Right || facing == Direction::Left || facing == Direction::None;
+    if (weapon.type == WeaponType::Axe) {
+        int axeSize = 10;
+        RasterPoint axeHead[3];
+        if (horizontal) {
+            axeHead[0] = { endX, endY - axeSize };
+            axeHead[1] = { endX + (facing == Direction::Left ? -axeSize : axeSize), endY };
+            axeHead[2] = { endX, endY + axeSize };
+        } else {
+            axeHead[0] = { endX - axeSize, endY };
+            axeHead[1] = { endX, endY + (facing == Direction::Down ? axeSize : -axeSize) };
+            axeHead[2] = { endX + axeSize, endY };
+        }
+        target.FillPolygon(axeHead, 3, Rasterizer::ToPixel(MakeColor(100, 100, 100)));
+        target.DrawPolygonOutline(axeHead, 3, weaponPixel);
+    }
+
+    if (weapon.type == WeaponType::Sword) {
+        int hiltSize = 8;
+        uint32_t hiltPixel = Rasterizer::ToPixel(MakeColor(139, 69, 19));
+        if (horizontal) {
+            target.DrawLine(x, y - hiltSize, x, y + hiltSize, 2, hiltPixel);
+        } else {
+            target.DrawLine(x - hiltSize, y, x + hiltSize, y, 2, hiltPixel);
+        }
+    }
+}
+
+void SoftwareRenderer::DrawMonsterShape(Rasterizer& target, int level, int x, int y) const {
+    RasterPoint body[6];
+    int r = MONSTER_SIZE / 2;
+    for (int i = 0; i < 6; i++) {
+        float angle = (float)i * 3.14159f / 3.0f - 3.14159f / 6.0f;
+        body[i].x = x + (int)(r * std::cos(angle));
+        body[i].y = y + (int)(r * std::sin(angle));
+    }
+    DrawOutlinedPolygon(target, body, 6, Rasterizer::ToPixel(content_->GetMonsterColor(level)));
+
+    uint32_t hornPixel = Rasterizer::ToPixel(MakeColor(100, 50, 50));
+    RasterPoint leftHorn[3] = {
+        { x - r/2, y - r/2 },
+        { x - r/3, y - r - 10 },
+        { x, y - r/2 }
+    };
+    DrawOutlinedPolygon(target, leftHorn, 3, hornPixel);
+    RasterPoint rightHorn[3] = {
+        { x, y - r/2 },
+        { x + r/3, y - r - 10 },
+        { x + r/2, y - r/2 }
+    };
+    DrawOutlinedPolygon(target, rightHorn, 3, hornPixel);
+
+    uint32_t eyePixel = Rasterizer::ToPixel(MakeColor(255, 0, 0));
+    int eyeSize = 5;
+    DrawOutlinedEllipse(target, x - r/3 - eyeSize, y - eyeSize - 3, x - r/3 + eyeSize, y + eyeSize - 3, eyePixel);
+    DrawOutlinedEllipse(target, x + r/3 - eyeSize, y - eyeSize - 3, x + r/3 + eyeSize, y + eyeSize - 3, eyePixel);
+
+    target.DrawLine(x - r/3, y + r/4, x - r/6, y + r/3, 2, OUTLINE);
+    target.DrawLine(x - r/6, y + r/3, x, y + r/4, 2, OUTLINE);
+    target.DrawLine(x, y + r/4, x + r/6, y + r/3, 2, OUTLINE);
+    target.DrawLine(x + r/6, y + r/3, x + r/3, y + r/4, 2, OUTLINE);
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include "ContentDatabase.h"
+#include "Rasterizer.h"
+#include "Simulation.h"
+#include <vector>
+
+// ============================================================================
+// 軟體繪圖後端（世界畫面）
+// 背景、怪獸、英雄與血條都直接寫進 Rasterizer 的像素緩衝區，不經過任何 GDI 呼叫；
+// 角色外觀與 EntityRenderer 相同，啟動時預先畫進精靈表，每幀以透明色貼圖
+// 不含平台程式碼：Win32 前端把 DIB section 掛上目標表面，基準測試則在記憶體中繪製
+// ============================================================================
+class SoftwareRenderer {
+public:
+    static constexpr int CELL_SIZE = 96;            // 精靈格子邊長
+    static constexpr int ANCHOR_X = 48;             // 角色中心在格子內的位置
+    static constexpr int ANCHOR_Y = 56;
+    static constexpr uint32_t KEY_PIXEL = 0x00FF00FF;   // 透明色
+    static constexpr int CULL_MARGIN = 64;          // 視野裁切的邊界（涵蓋格子與血條）
+
+private:
+    struct CellBounds {
+        int left, top, right, bottom;                // 不透明像素的外接框（格子內座標）
+    };
+
+    static constexpr int MONSTER_VARIANTS = 10;     // 等級 1-9，其餘等級共用第 0 格
+    static constexpr int FACING_VARIANTS = 5;       // Direction 的數量
+    static constexpr int WEAPON_VARIANTS = 17;      // 未裝備 + 前 16 把武器
+
+    const ContentDatabase* content_;     // 怪獸顏色與武器定義
+    Rasterizer sprites_;                 // 精靈表（單欄，每格連續存放）
+    std::vector<CellBounds> bounds_;     // 每格實際需要貼的範圍
+    int weaponVariants_;                 // 精靈表中的武器種類數（含未裝備）
+    Rasterizer tileRow_;                 // 背景的一列地磚，整段複製到每一條掃描線
+    std::vector<int> visible_;           // 本幀視野內的怪獸 ID
+    int culledCount_;
+    double spriteBuildMs_;
+
+    static int MonsterCell(int level);
+    static int HeroCell(Direction facing, int weaponIndex);
+    void DrawSprite(Rasterizer& target, int cell, int x, int y) const;
+    void ComputeBounds(int cell);
+
+    // 向量繪圖（建立精靈表與武器超出精靈表時使用）
+    void DrawHeroShape(Rasterizer& target, Direction facing, const WeaponStats& weapon, int x, int y) const;
+    void DrawWeapon(Rasterizer& target, Direction facing, const WeaponStats& weapon, int x, int y) const;
+    void DrawMonsterShape(Rasterizer& target, int level, int x, int y) const;
+    static void DrawOutlinedEllipse(Rasterizer& target, int left, int top, int right, int bottom, uint32_t fill);
+    static void DrawOutlinedPolygon(Rasterizer& target, const RasterPoint* points, int count, uint32_t fill);
+
+public:
+    SoftwareRenderer();
+
+    // 內容資料（更換後需重新呼叫 BuildSprites）
+    void SetContent(const ContentDatabase* content) { content_ = content; }
+    void BuildSprites();
+    double GetSpriteBuildMs() const { return spriteBuildMs_; }
+
+    // 世界畫面（camera 為視野左上角的地圖座標，alpha 為內插係數）
+    void DrawBackground(Rasterizer& target, Vector2D camera);
+    void DrawMonsters(Rasterizer& target, const Simulation& simulation, Vector2D camera, float alpha);
+    void DrawHero(Rasterizer& target, const Hero& hero, Vector2D camera, float alpha) const;
+    void RenderScene(Rasterizer& target, const Simulation& simulation, Vector2D camera, float alpha);
+
+    // 上一次 DrawMonsters 的結果（依 ID 排序）
+    const std::vector<int>& GetVisibleMonsters() const { return visible_; }
+    int GetCulledCount() const { return culledCount_; }
+};
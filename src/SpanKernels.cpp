@@ -0,0 +1,153 @@
+#include "SpanKernels.h"
+#include <cstring>
+
+#ifdef HEROWAR_X86
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// ============================================================================
+// 純量版本
+// ============================================================================
+void FillScalar(uint32_t* dst, int count, uint32_t color) {
+    for (int i = 0; i < count; i++) {
+        dst[i] = color;
+    }
+}
+
+void CopyScalar(uint32_t* dst, const uint32_t* src, int count) {
+    std::memcpy(dst, src, (size_t)count * sizeof(uint32_t));
+}
+
+void CopyKeyedScalar(uint32_t* dst, const uint32_t* src, int count, uint32_t key) {
+    for (int i = 0; i < count; i++) {
+        if (src[i] != key) dst[i] = src[i];
+    }
+}
+
+#ifdef HEROWAR_X86
+
+// ============================================================================
+// SSE2 版本（一次 4 像素）
+// ============================================================================
+void FillSSE2(uint32_t* dst, int count, uint32_t color) {
+    int i = 0;
+    // 先補齊到 16 位元組邊界，主迴圈改用對齊存取
+    for (; i < count && ((uintptr_t)(dst + i) & 15) != 0; i++) {
+        dst[i] = color;
+    }
+    __m128i value = _mm_set1_epi32((int)color);
+    for (; i + 8 <= count; i += 8) {
+        _mm_store_si128((__m128i*)(dst + i), value);
+        _mm_store_si128((__m128i*)(dst + i + 4), value);
+    }
+    for (; i + 4 <= count; i += 4) {
+        _mm_store_si128((__m128i*)(dst + i), value);
+    }
+    for (; i < count; i++) {
+        dst[i] = color;
+    }
+}
+
+void CopySSE2(uint32_t* dst, const uint32_t* src, int count) {
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_loadu_si128((const __m128i*)(src + i)));
+    }
+    for (; i < count; i++) {
+        dst[i] = src[i];
+    }
+}
+
+void CopyKeyedSSE2(uint32_t* dst, const uint32_t* src, int count, uint32_t key) {
+    __m128i keys = _mm_set1_epi32((int)key);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i transparent = _mm_cmpeq_epi32(s, keys);
+        // 整段透明時不必讀寫目標（精靈格子四周多半是透明色）
+        if (_mm_movemask_epi8(transparent) == 0xFFFF) continue;
+
+        __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+        __m128i result = _mm_or_si128(_mm_and_si128(transparent, d), _mm_andnot_si128(transparent, s));
+        _mm_storeu_si128((__m128i*)(dst + i), result);
+    }
+    for (; i < count; i++) {
+        if (src[i] != key) dst[i] = src[i];
+    }
+}
+
+// ============================================================================
+// AVX2 版本（一次 8 像素）
+// ============================================================================
+HEROWAR_TARGET_AVX2
+void FillAVX2(uint32_t* dst, int count, uint32_t color) {
+    int i = 0;
+    for (; i < count && ((uintptr_t)(dst + i) & 31) != 0; i++) {
+        dst[i] = color;
+    }
+    __m256i value = _mm256_set1_epi32((int)color);
+    for (; i + 16 <= count; i += 16) {
+        _mm256_store_si256((__m256i*)(dst + i), value);
+        _mm256_store_si256((__m256i*)(dst + i + 8), value);
+    }
+    for (; i + 8 <= count; i += 8) {
+        _mm256_store_si256((__m256i*)(dst + i), value);
+    }
+    for (; i < count; i++) {
+        dst[i] = color;
+    }
+}
+
+HEROWAR_TARGET_AVX2
+void CopyAVX2(uint32_t* dst, const uint32_t* src, int count) {
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_loadu_si256((const __m256i*)(src + i)));
+    }
+    for (; i < count; i++) {
+        dst[i] = src[i];
+    }
+}
+
+HEROWAR_TARGET_AVX2
+void CopyKeyedAVX2(uint32_t* dst, const uint32_t* src, int count, uint32_t key) {
+    __m256i keys = _mm256_set1_epi32((int)key);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i s = _mm256_loadu_si256((const __m256i*)(src + i));
+        __m256i transparent = _mm256_cmpeq_epi32(s, keys);
+        int mask = _mm256_movemask_epi8(transparent);
+        if (mask == -1) continue;
+
+        if (mask == 0) {
+            _mm256_storeu_si256((__m256i*)(dst + i), s);
+        } else {
+            // 只寫入不透明的像素
+            _mm256_maskstore_epi32((int*)(dst + i), _mm256_xor_si256(transparent, _mm256_set1_epi32(-1)), s);
+        }
+    }
+    for (; i < count; i++) {
+        if (src[i] != key) dst[i] = src[i];
+    }
+}
+
+#endif
+
+const SpanKernels KERNELS[(int)SimdLevel::Count] = {
+    { FillScalar, CopyScalar, CopyKeyedScalar },
+#ifdef HEROWAR_X86
+    { FillSSE2, CopySSE2, CopyKeyedSSE2 },
+    { FillAVX2, CopyAVX2, CopyKeyedAVX2 },
+#else
+    { FillScalar, CopyScalar, CopyKeyedScalar },
+    { FillScalar, CopyScalar, CopyKeyedScalar },
+#endif
+};
+
+}
+
+const SpanKernels& GetSpanKernels(SimdLevel level) {
+    return KERNELS[(int)ClampSimdLevel(level)];
+}
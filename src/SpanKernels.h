@@ -0,0 +1,19 @@
+#pragma once
+#include "Simd.h"
+#include <cstdint>
+
+// ============================================================================
+// 像素列（span）核心
+// 軟體繪圖的所有填色與貼圖最後都落在這三個函式，各有純量 / SSE2 / AVX2 版本，
+// 依 SimdLevel 取得對應的函式表；像素格式為 0x00RRGGBB（與 32 位元 DIB 相同）
+// ============================================================================
+struct SpanKernels {
+    // dst[0..count) = color
+    void (*fill)(uint32_t* dst, int count, uint32_t color);
+    // dst[0..count) = src[0..count)
+    void (*copy)(uint32_t* dst, const uint32_t* src, int count);
+    // 與 copy 相同，但 src 等於 key 的像素保留 dst 原值（透明色貼圖）
+    void (*copyKeyed)(uint32_t* dst, const uint32_t* src, int count, uint32_t key);
+};
+
+const SpanKernels& GetSpanKernels(SimdLevel level);
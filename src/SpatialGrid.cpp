@@ -0,0 +1,142 @@
+#include "SpatialGrid.h"
+#include <algorithm>
+
+SpatialGrid::SpatialGrid(int worldWidth, int worldHeight, int cellSize)
+    : cellSize_(cellSize)
+    , count_(0)
+{
+    cols_ = (worldWidth + cellSize - 1) / cellSize;
+    rows_ = (worldHeight + cellSize - 1) / cellSize;
+    cellHead_.assign(cols_ * rows_, -1);
+}
+
+void SpatialGrid::CellCoords(Vector2D pos, int& cx, int& cy) const {
+    cx = (int)(pos.x / cellSize_);
+    cy = (int)(pos.y / cellSize_);
+    cx = std::max(0, std::min(cx, cols_ - 1));
+    cy = std::max(0, std::min(cy, rows_ - 1));
+}
+
+int SpatialGrid::GetCellIndex(Vector2D pos) const {
+    int cx, cy;
+    CellCoords(pos, cx, cy);
+    return cy * cols_ + cx;
+}
+
+void SpatialGrid::AddToCell(int id, int cell) {
+    int head = cellHead_[cell];
+    entityCell_[id] = cell;
+    entityPrev_[id] = -1;
+    entityNext_[id] = head;
+    if (head >= 0) {
+        entityPrev_[head] = id;
+    }
+    cellHead_[cell] = id;
+}
+
+void SpatialGrid::RemoveFromCell(int id) {
+    int prev = entityPrev_[id];
+    int next = entityNext_[id];
+    if (prev >= 0) {
+        entityNext_[prev] = next;
+    } else {
+        cellHead_[entityCell_[id]] = next;
+    }
+    if (next >= 0) {
+        entityPrev_[next] = prev;
+    }
+
+    entityCell_[id] = -1;
+}
+
+void SpatialGrid::Clear() {
+    std::fill(cellHead_.begin(), cellHead_.end(), -1);
+    std::fill(entityCell_.begin(), entityCell_.end(), -1);
+    count_ = 0;
+}
+
+void SpatialGrid::Reserve(int entityCount) {
+    if (entityCount <= (int)entityCell_.size()) return;
+
+    entityCell_.resize(entityCount, -1);
+    entityNext_.resize(entityCount, -1);
+    entityPrev_.resize(entityCount, -1);
+    entityPos_.resize(entityCount);
+}
+
+void SpatialGrid::Insert(int id, Vector2D pos) {
+    if (id < 0) return;
+
+    if (id >= (int)entityCell_.size()) {
+        Reserve(id + 1);
+    }
+
+    if (entityCell_[id] >= 0) {
+        Update(id, pos);
+        return;
+    }
+
+    entityPos_[id] = pos;
+    AddToCell(id, GetCellIndex(pos));
+    count_++;
+}
+
+void SpatialGrid::Remove(int id) {
+    if (!Contains(id)) return;
+
+    RemoveFromCell(id);
+    count_--;
+}
+
+void SpatialGrid::Update(int id, Vector2D pos) {
+    if (!Contains(id)) return;
+
+    entityPos_[id] = pos;
+
+    // 只有跨越格子邊界時才需要搬移
+    int cell = GetCellIndex(pos);
+    if (cell != entityCell_[id]) {
+        RemoveFromCell(id);
+        AddToCell(id, cell);
+    }
+}
+
+bool SpatialGrid::Contains(int id) const {
+    return id >= 0 && id < (int)entityCell_.size() && entityCell_[id] >= 0;
+}
+
+void SpatialGrid::QueryRadius(Vector2D center, float radius, std::vector<int>& out) const {
+    int minX, minY, maxX, maxY;
+    CellCoords(Vector2D(center.x - radius, center.y - radius), minX, minY);
+    CellCoords(Vector2D(center.x + radius, center.y + radius), maxX, maxY);
+
+    float radiusSq = radius * radius;
+    for (int cy = minY; cy <= maxY; cy++) {
+        for (int cx = minX; cx <= maxX; cx++) {
+            for (int id = cellHead_[cy * cols_ + cx]; id >= 0; id = entityNext_[id]) {
+                float dx = entityPos_[id].x - center.x;
+                float dy = entityPos_[id].y - center.y;
+                if (dx * dx + dy * dy <= radiusSq) {
+                    out.push_back(id);
+                }
+            }
+        }
+    }
+}
+
+void SpatialGrid::QueryRect(float left, float top, float right, float bottom, std::vector<int>& out) const {
+    int minX, minY, maxX, maxY;
+    CellCoords(Vector2D(left, top), minX, minY);
+    CellCoords(Vector2D(right, bottom), maxX, maxY);
+
+    for (int cy = minY; cy <= maxY; cy++) {
+        for (int cx = minX; cx <= maxX; cx++) {
+            for (int id = cellHead_[cy * cols_ + cx]; id >= 0; id = entityNext_[id]) {
+                const Vector2D& p = entityPos_[id];
+                if (p.x >= left && p.x <= right && p.y >= top && p.y <= bottom) {
+                    out.push_back(id);
+                }
+            }
+        }
+    }
+}
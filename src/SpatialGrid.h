@@ -0,0 +1,48 @@
+#pragma once
+#include "Types.h"
+#include <vector>
+
+// ============================================================================
+// 均勻網格空間索引
+// 以 TILE_SIZE 為格子大小，將實體依位置分桶，提供半徑與矩形查詢
+// 每格以實體 ID 串成雙向鏈結串列，登錄資料全部依 ID 存放；Reserve 之後搬移格子不會配置記憶體
+// ============================================================================
+class SpatialGrid {
+private:
+    int cellSize_;                           // 格子邊長
+    int cols_;                               // 橫向格子數
+    int rows_;                               // 縱向格子數
+    std::vector<int> cellHead_;              // 每個格子串列的第一個實體 ID（-1 表示空格）
+    std::vector<int> entityCell_;            // 實體所在格子（-1 表示未登錄）
+    std::vector<int> entityNext_;            // 同格下一個實體 ID
+    std::vector<int> entityPrev_;            // 同格上一個實體 ID
+    std::vector<Vector2D> entityPos_;        // 實體最後登錄的位置
+    int count_;                              // 已登錄實體數
+
+    void CellCoords(Vector2D pos, int& cx, int& cy) const;
+    void AddToCell(int id, int cell);
+    void RemoveFromCell(int id);
+
+public:
+    SpatialGrid(int worldWidth = GameConstants::MAP_WIDTH,
+                int worldHeight = GameConstants::MAP_HEIGHT,
+                int cellSize = GameConstants::TILE_SIZE);
+
+    // 登錄管理
+    void Clear();
+    void Reserve(int entityCount);           // 預先配置 ID 0 ~ entityCount-1 的登錄資料
+    void Insert(int id, Vector2D pos);
+    void Remove(int id);
+    void Update(int id, Vector2D pos);
+    bool Contains(int id) const;
+
+    // 查詢（結果附加到 out 後方，不清除原內容）
+    void QueryRadius(Vector2D center, float radius, std::vector<int>& out) const;
+    void QueryRect(float left, float top, float right, float bottom, std::vector<int>& out) const;
+
+    // 存取方法
+    int GetCount() const { return count_; }
+    int GetCellSize() const { return cellSize_; }
+    int GetCellIndex(Vector2D pos) const;
+    Vector2D GetPosition(int id) const { return entityPos_[id]; }     // 最後登錄的位置
+};
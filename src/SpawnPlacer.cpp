@@ -0,0 +1,234 @@
+#include "SpawnPlacer.h"
+#include <algorithm>
+
+using namespace GameConstants;
+
+SpawnPlacer::SpawnPlacer()
+    : left_(0)
+    , top_(0)
+    , right_((float)MAP_WIDTH)
+    , bottom_((float)MAP_HEIGHT)
+    , minSpacing_((float)MONSTER_SIZE)
+    , weightTotal_(0)
+    , maxRadius_(0)
+    , stepCos_(std::cos(6.2831853f / CANDIDATE_ATTEMPTS))
+    , stepSin_(std::sin(6.2831853f / CANDIDATE_ATTEMPTS))
+{
+    // 預設分布與原本的等級擲骰相同：1~5 級依序 40/25/15/10/5%，6~9 級各 1.25%
+    const int weights[MAX_LEVEL + 1] = { 0, 3200, 2000, 1200, 800, 400, 100, 100, 100, 100 };
+    for (int level = 0; level <= MAX_LEVEL; level++) {
+        levelWeight_[level] = weights[level];
+        weightTotal_ += weights[level];
+        // 高等級怪獸佔用較大的範圍
+        levelScale_[level] = level >= 6 ? 1.5f : 1.0f;
+    }
+    RebuildGrid();
+}
+
+void SpawnPlacer::SetBounds(float left, float top, float right, float bottom) {
+    left_ = left;
+    top_ = top;
+    right_ = std::max(left + 1.0f, right);
+    bottom_ = std::max(top + 1.0f, bottom);
+    RebuildGrid();
+}
+
+void SpawnPlacer::SetMinSpacing(float spacing) {
+    minSpacing_ = std::max(1.0f, spacing);
+    RebuildGrid();
+}
+
+void SpawnPlacer::SetLevelWeight(int level, int weight) {
+    if (level < 1 || level > MAX_LEVEL) return;
+
+    weightTotal_ += std::max(0, weight) - levelWeight_[level];
+    levelWeight_[level] = std::max(0, weight);
+}
+
+void SpawnPlacer::SetLevelSpacing(int level, float scale) {
+    if (level < 1 || level > MAX_LEVEL) return;
+
+    levelScale_[level] = std::max(1.0f, std::min(scale, MAX_SPACING_SCALE));
+}
+
+float SpawnPlacer::FitSpacing(float area, int count) {
+    // 填滿後的密度約為 0.8 / r²（含高等級的較大間距）；以 0.7 反推，填滿後約有 1.1 倍的點可抽
+    if (count <= 0) return std::sqrt(area);
+    return std::sqrt(0.7f * area / count);
+}
+
+void SpawnPlacer::RebuildGrid() {
+    cellSize_ = minSpacing_ / 1.41421356f;
+    cols_ = std::max(1, (int)std::ceil((right_ - left_) / cellSize_));
+    rows_ = std::max(1, (int)std::ceil((bottom_ - top_) / cellSize_));
+
+    // 鄰格偏移依最近距離排序：檢查時先看最可能衝突的近鄰，超出間距即可停止
+    int range = (int)std::ceil(MAX_SPACING_SCALE * minSpacing_ / cellSize_);
+    padding_ = range;
+    stride_ = cols_ + 2 * padding_;
+    neighborOffsets_.clear();
+    for (int dy = -range; dy <= range; dy++) {
+        for (int dx = -range; dx <= range; dx++) {
+            float gapX = std::max(0, std::abs(dx) - 1) * cellSize_;
+            float gapY = std::max(0, std::abs(dy) - 1) * cellSize_;
+            neighborOffsets_.push_back({ dy * stride_ + dx, gapX * gapX + gapY * gapY });
+        }
+    }
+    std::sort(neighborOffsets_.begin(), neighborOffsets_.end(),
+              [](const CellOffset& a, const CellOffset& b) { return a.minDistanceSq < b.minDistanceSq; });
+
+    // 每格至多一點，點數上限即格數；先配置好，之後每波重用不再配置
+    size_t cellCount = (size_t)stride_ * (rows_ + 2 * padding_);
+    cells_.assign(cellCount, EmptyCell());
+    points_.reserve((size_t)cols_ * rows_);
+    active_.reserve((size_t)cols_ * rows_);
+    Begin();
+}
+
+// ============================================================================
+// 配置流程
+// ============================================================================
+void SpawnPlacer::Begin() {
+    std::fill(cells_.begin(), cells_.end(), EmptyCell());
+    points_.clear();
+    active_.clear();
+    exclusions_.clear();
+    maxRadius_ = 0;
+}
+
+void SpawnPlacer::AddExclusion(Vector2D center, float radius) {
+    exclusions_.push_back({ center, radius * radius });
+}
+
+void SpawnPlacer::AddOccupied(Vector2D pos, int level) {
+    int cell = CellIndex(pos);
+    if (cell < 0 || cells_[cell].level > 0) return;
+
+    // 既有怪獸也會向外擴張，讓補位從空洞邊緣填起
+    level = std::max(1, std::min(level, MAX_LEVEL));
+    Insert({ pos, level }, cell);
+}
+
+int SpawnPlacer::Generate(int count, Random& rng, std::vector<SpawnPoint>& out) {
+    if (count <= 0) return 0;
+
+    const float width = right_ - left_;
+    const float height = bottom_ - top_;
+    const int firstNew = (int)points_.size();
+    int seedAttempts = 0;
+
+    for (;;) {
+        if (active_.empty()) {
+            // 隨機播種：找出尚未填滿的區域（例如被排除區隔開的角落）
+            if (seedAttempts >= SEED_ATTEMPTS) break;
+            seedAttempts++;
+
+            int level = RollLevel(rng);
+            Vector2D pos(left_ + rng.NextFloat() * width, top_ + rng.NextFloat() * height);
+            if (CanPlace(pos, Radius(level))) {
+                Insert({ pos, level }, CellIndex(pos));
+            }
+            continue;
+        }
+
+        int slot = (int)active_.size() - 1;
+        const SpawnPoint base = points_[active_[slot]];
+        const float baseRadius = Radius(base.level);
+
+        // 候選點緊貼在間距圓外、以隨機起始角等分一圈（Roberts 的改良版 Bridson），
+        // 比在 [r, 2r) 環帶上亂撒更密，所需的嘗試次數也少得多
+        // 方向以固定角度旋轉取得，每個活躍點只需一次 sin / cos
+        bool placed = false;
+        float startAngle = rng.NextFloat() * 6.2831853f;
+        float dirX = std::cos(startAngle);
+        float dirY = std::sin(startAngle);
+        for (int attempt = 0; attempt < CANDIDATE_ATTEMPTS; attempt++) {
+            int level = RollLevel(rng);
+            float distance = std::max(baseRadius, Radius(level)) * 1.0001f;
+            Vector2D pos(base.pos.x + dirX * distance, base.pos.y + dirY * distance);
+
+            float nextX = dirX * stepCos_ - dirY * stepSin_;
+            dirY = dirX * stepSin_ + dirY * stepCos_;
+            dirX = nextX;
+
+            if (CanPlace(pos, Radius(level))) {
+                Insert({ pos, level }, CellIndex(pos));
+                placed = true;
+                break;
+            }
+        }
+
+        if (!placed) {
+            active_[slot] = active_.back();
+            active_.pop_back();
+        }
+    }
+
+    // 新點多於需求時以部分 Fisher-Yates 均勻抽樣，保留藍噪聲分布與最小間距
+    int generated = (int)points_.size() - firstNew;
+    int taken = std::min(count, generated);
+    for (int i = 0; i < taken; i++) {
+        int pick = i + rng.NextInt(generated - i);
+        std::swap(points_[firstNew + i], points_[firstNew + pick]);
+        out.push_back(points_[firstNew + i]);
+    }
+    return taken;
+}
+
+// ============================================================================
+// 內部工具
+// ============================================================================
+int SpawnPlacer::RollLevel(Random& rng) const {
+    if (weightTotal_ <= 0) return 1;
+
+    int roll = rng.NextInt(weightTotal_);
+    for (int level = 1; level <= MAX_LEVEL; level++) {
+        roll -= levelWeight_[level];
+        if (roll < 0) return level;
+    }
+    return MAX_LEVEL;
+}
+
+int SpawnPlacer::CellIndex(Vector2D pos) const {
+    if (pos.x < left_ || pos.y < top_ || pos.x >= right_ || pos.y >= bottom_) return -1;
+
+    int cx = std::min((int)((pos.x - left_) / cellSize_), cols_ - 1);
+    int cy = std::min((int)((pos.y - top_) / cellSize_), rows_ - 1);
+    return (cy + padding_) * stride_ + cx + padding_;
+}
+
+bool SpawnPlacer::CanPlace(Vector2D pos, float radius) const {
+    int cell = CellIndex(pos);
+    if (cell < 0 || cells_[cell].level > 0) return false;
+
+    for (const Exclusion& zone : exclusions_) {
+        float dx = pos.x - zone.center.x;
+        float dy = pos.y - zone.center.y;
+        if (dx * dx + dy * dy < zone.radiusSq) return false;
+    }
+
+    // 鄰近點可能擁有較大的間距，搜尋範圍取兩者較大值
+    float reach = std::max(radius, maxRadius_);
+    float reachSq = reach * reach;
+
+    for (const CellOffset& offset : neighborOffsets_) {
+        if (offset.minDistanceSq >= reachSq) break;
+
+        const SpawnPoint& other = cells_[cell + offset.delta];
+        if (other.level == 0) continue;
+
+        float required = std::max(radius, Radius(other.level));
+        float dx = pos.x - other.pos.x;
+        float dy = pos.y - other.pos.y;
+        if (dx * dx + dy * dy < required * required) return false;
+    }
+    return true;
+}
+
+void SpawnPlacer::Insert(const SpawnPoint& point, int cell) {
+    int index = (int)points_.size();
+    points_.push_back(point);
+    cells_[cell] = point;
+    active_.push_back(index);
+    maxRadius_ = std::max(maxRadius_, Radius(point.level));
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include "Random.h"
+#include "Types.h"
+#include <vector>
+
+// ============================================================================
+// 生成點
+// ============================================================================
+struct SpawnPoint {
+    Vector2D pos;
+    int level;
+};
+
+// ============================================================================
+// 生成位置配置器（Poisson-disk / 藍噪聲取樣）
+// 以 Bridson 演算法在背景網格上擴張：任兩點的距離不小於兩者等級間距的較大值，
+// 並避開排除區與既有怪獸。網格格寬為最小間距 / √2，每格至多一個點
+//
+// 終止保證：每次嘗試不是放下一點（至多網格格數個）、就是淘汰一個活躍點，
+// 每點最多 CANDIDATE_ATTEMPTS 次候選，另有 SEED_ATTEMPTS 次隨機播種，
+// 因此總嘗試次數有上限；空間不足時回傳的點數少於要求，不會無限重試
+// ============================================================================
+class SpawnPlacer {
+public:
+    static constexpr int MAX_LEVEL = 9;
+    static constexpr int CANDIDATE_ATTEMPTS = 8;     // 每個活躍點的候選次數
+    static constexpr int SEED_ATTEMPTS = 64;         // 活躍串列清空後的隨機播種次數
+    static constexpr float MAX_SPACING_SCALE = 2.0f; // 等級間距倍率上限
+
+private:
+    struct Exclusion {
+        Vector2D center;
+        float radiusSq;
+    };
+
+    struct CellOffset {
+        int delta;                           // 格子索引差
+        float minDistanceSq;                 // 兩格之間最近可能的距離平方
+    };
+
+    float left_, top_, right_, bottom_;      // 可生成範圍 [left, right) x [top, bottom)
+    float minSpacing_;                       // 最小間距（倍率 1 的等級）
+    float cellSize_;                         // 背景網格格寬
+    int cols_;
+    int rows_;
+    int padding_;                            // 四周的空白格數，鄰格檢查不必判斷邊界
+    int stride_;                             // 含空白格的每列格數
+    float levelScale_[MAX_LEVEL + 1];        // 各等級的間距倍率（>= 1，越大分布越疏）
+    int levelWeight_[MAX_LEVEL + 1];         // 各等級的生成權重
+    int weightTotal_;
+    float maxRadius_;                        // 目前已放置的點中最大的間距
+    std::vector<SpawnPoint> cells_;          // 每格的點（直接存放位置，level 為 0 表示空格）
+    std::vector<CellOffset> neighborOffsets_;    // 鄰格偏移，依距離由近到遠排序
+    std::vector<SpawnPoint> points_;         // 已放置的點（前段為既有怪獸，之後是新點）
+    std::vector<int> active_;                // 仍可向外擴張的點索引
+    std::vector<Exclusion> exclusions_;
+    float stepCos_;                          // 相鄰候選方向的旋轉量
+    float stepSin_;
+
+    void RebuildGrid();
+    int RollLevel(Random& rng) const;
+    float Radius(int level) const { return minSpacing_ * levelScale_[level]; }
+    int CellIndex(Vector2D pos) const;
+    bool CanPlace(Vector2D pos, float radius) const;
+    void Insert(const SpawnPoint& point, int cell);
+    static SpawnPoint EmptyCell() { return { Vector2D(), 0 }; }
+
+public:
+    SpawnPlacer();
+
+    // 設定（會重建背景網格，應在開局時呼叫，而非每波）
+    void SetBounds(float left, float top, float right, float bottom);
+    void SetMinSpacing(float spacing);
+    void SetLevelWeight(int level, int weight);
+    void SetLevelSpacing(int level, float scale);
+
+    // 在 area 面積內放置約 count 個點時適用的間距（留約兩成餘裕）
+    static float FitSpacing(float area, int count);
+
+    // 每次配置：Begin 後加入排除區與既有怪獸，再呼叫 Generate
+    void Begin();
+    void AddExclusion(Vector2D center, float radius);
+    void AddOccupied(Vector2D pos, int level);
+
+    // 產生至多 count 個位置並附加到 out，回傳實際數量
+    // 先把可用空間填滿，再均勻抽出 count 個，讓生成點散布整張地圖
+    int Generate(int count, Random& rng, std::vector<SpawnPoint>& out);
+
+    // 存取方法
+    float GetMinSpacing() const { return minSpacing_; }
+};
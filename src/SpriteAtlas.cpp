@@ -0,0 +1,89 @@
+#include "SpriteAtlas.h"
+
+SpriteAtlas::SpriteAtlas()
+    : dc_(nullptr)
+    , bitmap_(nullptr)
+    , oldBitmap_(nullptr)
+    , mask_(nullptr)
+    , cellCount_(0)
+    , columns_(0)
+{
+}
+
+SpriteAtlas::~SpriteAtlas() {
+    Release();
+}
+
+HDC SpriteAtlas::Begin(int cellCount) {
+    Release();
+    
+    cellCount_ = cellCount;
+    columns_ = 1;
+    while (columns_ * columns_ < cellCount) columns_++;
+    int rows = (cellCount + columns_ - 1) / columns_;
+    int width = columns_ * CELL_SIZE;
+    int height = rows * CELL_SIZE;
+    
+    HDC screenDC = GetDC(NULL);
+    dc_ = CreateCompatibleDC(screenDC);
+    bitmap_ = CreateCompatibleBitmap(screenDC, width, height);
+    oldBitmap_ = (HBITMAP)SelectObject(dc_, bitmap_);
+    ReleaseDC(NULL, screenDC);
+    
+    HBRUSH keyBrush = CreateSolidBrush(KEY_COLOR);
+    RECT rect = { 0, 0, width, height };
+    FillRect(dc_, &rect, keyBrush);
+    DeleteObject(keyBrush);
+    
+    return dc_;
+}
+
+void SpriteAtlas::End() {
+    if (!dc_) return;
+    
+    int rows = (cellCount_ + columns_ - 1) / columns_;
+    int width = columns_ * CELL_SIZE;
+    int height = rows * CELL_SIZE;
+    
+    // 彩色轉單色時，與背景色相同的像素變成 1，其餘為 0；
+    // 再反相一次，讓不透明的像素為 1
+    mask_ = CreateBitmap(width, height, 1, 1, NULL);
+    HDC maskDC = CreateCompatibleDC(dc_);
+    HBITMAP oldMask = (HBITMAP)SelectObject(maskDC, mask_);
+    COLORREF oldBk = SetBkColor(dc_, KEY_COLOR);
+    BitBlt(maskDC, 0, 0, width, height, dc_, 0, 0, NOTSRCCOPY);
+    SetBkColor(dc_, oldBk);
+    SelectObject(maskDC, oldMask);
+    DeleteDC(maskDC);
+}
+
+void SpriteAtlas::Release() {
+    if (mask_) {
+        DeleteObject(mask_);
+        mask_ = nullptr;
+    }
+    if (dc_) {
+        SelectObject(dc_, oldBitmap_);
+        DeleteObject(bitmap_);
+        DeleteDC(dc_);
+        dc_ = nullptr;
+        bitmap_ = nullptr;
+    }
+    cellCount_ = 0;
+}
+
+POINT SpriteAtlas::GetAnchor(int cell) const {
+    POINT anchor = { (cell % columns_) * CELL_SIZE + ANCHOR_X,
+                     (cell / columns_) * CELL_SIZE + ANCHOR_Y };
+    return anchor;
+}
+
+void SpriteAtlas::Draw(HDC hdc, int cell, int screenX, int screenY) const {
+    int srcX = (cell % columns_) * CELL_SIZE;
+    int srcY = (cell / columns_) * CELL_SIZE;
+    
+    // 遮罩為 1 的像素複製圖集內容，為 0 的像素保留目標原樣
+    MaskBlt(hdc, screenX - ANCHOR_X, screenY - ANCHOR_Y, CELL_SIZE, CELL_SIZE,
+            dc_, srcX, srcY, mask_, srcX, srcY,
+            MAKEROP4(SRCCOPY, 0x00AA0029));
+}
@@ -0,0 +1,44 @@
+#pragma once
+#include <windows.h>
+
+// ============================================================================
+// 精靈圖集
+// 將固定大小的格子排成一張點陣圖，並附上單色遮罩；
+// 每個格子在啟動時畫一次，之後每幀以一次 MaskBlt 貼到畫面上
+// ============================================================================
+class SpriteAtlas {
+private:
+    HDC dc_;                 // 圖集記憶體 DC
+    HBITMAP bitmap_;         // 彩色圖像（透明處為 KEY_COLOR）
+    HBITMAP oldBitmap_;
+    HBITMAP mask_;           // 單色遮罩（1 = 不透明）
+    int cellCount_;
+    int columns_;
+
+public:
+    static constexpr int CELL_SIZE = 96;        // 格子邊長
+    static constexpr int ANCHOR_X = 48;         // 角色中心在格子內的位置
+    static constexpr int ANCHOR_Y = 56;
+    static constexpr COLORREF KEY_COLOR = RGB(255, 0, 255);
+
+    SpriteAtlas();
+    ~SpriteAtlas();
+
+    SpriteAtlas(const SpriteAtlas&) = delete;
+    SpriteAtlas& operator=(const SpriteAtlas&) = delete;
+
+    // 配置圖集並以透明色清空，回傳可繪製的 DC
+    HDC Begin(int cellCount);
+    // 所有格子畫完後由透明色產生遮罩
+    void End();
+    void Release();
+
+    // 格子在圖集 DC 中的錨點座標（繪製時以此為角色中心）
+    POINT GetAnchor(int cell) const;
+
+    // 將格子以錨點對齊 (screenX, screenY) 貼到目標 DC
+    void Draw(HDC hdc, int cell, int screenX, int screenY) const;
+
+    bool IsReady() const { return mask_ != nullptr; }
+    int GetCellCount() const { return cellCount_; }
+};
@@ -0,0 +1,154 @@
+#include "TextCache.h"
+#include <algorithm>
+#include <cstring>
+
+#pragma comment(lib, "msimg32.lib")
+
+TextCache::TextCache()
+    : dc_(nullptr)
+    , bitmap_(nullptr)
+    , oldBitmap_(nullptr)
+    , pixels_(nullptr)
+    , pitch_(0)
+    , frame_()
+{
+}
+
+TextCache::~TextCache() {
+    Release();
+}
+
+bool TextCache::Initialize(int capacity) {
+    Release();
+    if (capacity <= 0) return false;
+    
+    int rows = (capacity + COLUMNS - 1) / COLUMNS;
+    int width = COLUMNS * CELL_WIDTH;
+    int height = rows * CELL_HEIGHT;
+    
+    BITMAPINFO info = {};
+    info.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+    info.bmiHeader.biWidth = width;
+    info.bmiHeader.biHeight = -height;      // 由上而下
+    info.bmiHeader.biPlanes = 1;
+    info.bmiHeader.biBitCount = 32;
+    info.bmiHeader.biCompression = BI_RGB;
+    
+    void* bits = nullptr;
+    HDC screenDC = GetDC(NULL);
+    bitmap_ = CreateDIBSection(screenDC, &info, DIB_RGB_COLORS, &bits, NULL, 0);
+    if (!bitmap_) {
+        ReleaseDC(NULL, screenDC);
+        return false;
+    }
+    dc_ = CreateCompatibleDC(screenDC);
+    ReleaseDC(NULL, screenDC);
+    oldBitmap_ = (HBITMAP)SelectObject(dc_, bitmap_);
+    pixels_ = (uint32_t*)bits;
+    pitch_ = width;
+    
+    // 一律以白字畫在黑底上，之後由亮度換算覆蓋率
+    SetBkMode(dc_, TRANSPARENT);
+    SetTextAlign(dc_, TA_LEFT | TA_TOP);
+    SetTextColor(dc_, RGB(255, 255, 255));
+    
+    index_.Reset(capacity);
+    cells_.assign(capacity, Cell());
+    return true;
+}
+
+void TextCache::Release() {
+    if (dc_) {
+        SelectObject(dc_, oldBitmap_);
+        DeleteObject(bitmap_);
+        DeleteDC(dc_);
+        dc_ = nullptr;
+        bitmap_ = nullptr;
+    }
+    pixels_ = nullptr;
+    index_.Reset(0);
+    cells_.clear();
+}
+
+void TextCache::Rasterize(int slot, HFONT font, COLORREF color, const wchar_t* text, int length) {
+    Cell& cell = cells_[slot];
+    HFONT oldFont = (HFONT)SelectObject(dc_, font);
+    
+    SIZE size = {};
+    GetTextExtentPoint32(dc_, text, length, &size);
+    if (size.cx <= 0 || size.cy <= 0 || size.cx > CELL_WIDTH || size.cy > CELL_HEIGHT) {
+        cell.width = 0;
+        cell.height = 0;
+        SelectObject(dc_, oldFont);
+        return;
+    }
+    
+    int cellX = (slot % COLUMNS) * CELL_WIDTH;
+    int cellY = (slot / COLUMNS) * CELL_HEIGHT;
+    
+    // 寫入像素前後都要等 GDI 完成排入佇列的繪圖
+    GdiFlush();
+    for (int y = 0; y < size.cy; y++) {
+        std::memset(pixels_ + (size_t)(cellY + y) * pitch_ + cellX, 0, size.cx * sizeof(uint32_t));
+    }
+    TextOut(dc_, cellX, cellY, text, length);
+    GdiFlush();
+    SelectObject(dc_, oldFont);
+    
+    // 亮度即覆蓋率：轉成預乘 alpha 的目標顏色，AlphaBlend 時反鋸齒邊緣與背景正確混合
+    const uint32_t red = GetRValue(color);
+    const uint32_t green = GetGValue(color);
+    const uint32_t blue = GetBValue(color);
+    for (int y = 0; y < size.cy; y++) {
+        uint32_t* row = pixels_ + (size_t)(cellY + y) * pitch_ + cellX;
+        for (int x = 0; x < size.cx; x++) {
+            uint32_t pixel = row[x];
+            uint32_t alpha = std::max(pixel & 0xFF, std::max((pixel >> 8) & 0xFF, (pixel >> 16) & 0xFF));
+            row[x] = (alpha << 24) |
+                     (((red * alpha + 127) / 255) << 16) |
+                     (((green * alpha + 127) / 255) << 8) |
+                     ((blue * alpha + 127) / 255);
+        }
+    }
+    
+    cell.width = size.cx;
+    cell.height = size.cy;
+}
+
+void TextCache::Draw(HDC hdc, int x, int y, const wchar_t* text, int length) {
+    frame_.draws++;
+    
+    // 基線對齊與目前位置模式不常用，交給 TextOut
+    UINT align = GetTextAlign(hdc);
+    if (!dc_ || (align & TA_BASELINE) == TA_BASELINE || (align & TA_UPDATECP)) {
+        frame_.fallbacks++;
+        TextOut(hdc, x, y, text, length);
+        return;
+    }
+    
+    HFONT font = (HFONT)GetCurrentObject(hdc, OBJ_FONT);
+    COLORREF color = GetTextColor(hdc);
+    bool inserted = false;
+    int slot = index_.Lookup((uint64_t)(uintptr_t)font, color, text, length, inserted);
+    if (slot >= 0 && inserted) {
+        Rasterize(slot, font, color, text, length);
+    }
+    
+    if (slot < 0 || cells_[slot].width == 0) {
+        frame_.fallbacks++;
+        TextOut(hdc, x, y, text, length);
+        return;
+    }
+    if (inserted) frame_.rasterized++;
+    else frame_.hits++;
+    
+    const Cell& cell = cells_[slot];
+    if ((align & TA_CENTER) == TA_CENTER) x -= cell.width / 2;
+    else if (align & TA_RIGHT) x -= cell.width;
+    if (align & TA_BOTTOM) y -= cell.height;
+    
+    BLENDFUNCTION blend = { AC_SRC_OVER, 0, 255, AC_SRC_ALPHA };
+    AlphaBlend(hdc, x, y, cell.width, cell.height,
+               dc_, (slot % COLUMNS) * CELL_WIDTH, (slot / COLUMNS) * CELL_HEIGHT,
+               cell.width, cell.height, blend);
+}
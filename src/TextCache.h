@@ -0,0 +1,63 @@
+#pragma once
+#include <windows.h>
+#include "TextCacheIndex.h"
+#include <cstdint>
+#include <vector>
+
+// ============================================================================
+// 文字點陣圖快取（GDI）
+// 常用字串依（字型, 顏色, 文字）預先畫進一張 32 位元 DIB section 的固定大小格子，
+// 之後每次繪製只需一次 AlphaBlend；格子以 LRU 淘汰，只有新字串才重新點陣化
+// Draw 的用法與 TextOut 相同：字型、顏色與對齊方式都取自目標 DC 目前的設定
+// 超過格子大小或長度上限的字串直接改用 TextOut
+// ============================================================================
+struct TextCacheFrameStats {
+    int draws;               // 本幀繪製次數
+    int hits;                // 直接貼上快取格子
+    int rasterized;          // 新字串（含淘汰後重畫）
+    int fallbacks;           // 字串太大，直接 TextOut
+};
+
+class TextCache {
+public:
+    static constexpr int CELL_WIDTH = 512;         // 格子大小（像素）
+    static constexpr int CELL_HEIGHT = 24;
+    static constexpr int COLUMNS = 4;
+    static constexpr int DEFAULT_CAPACITY = 128;
+
+private:
+    struct Cell {
+        int width;           // 字串實際大小（0 表示太大，改用 TextOut）
+        int height;
+    };
+
+    TextCacheIndex index_;
+    std::vector<Cell> cells_;
+    HDC dc_;
+    HBITMAP bitmap_;
+    HBITMAP oldBitmap_;
+    uint32_t* pixels_;       // DIB section 像素（預乘 alpha 的 BGRA）
+    int pitch_;              // 每列像素數
+    TextCacheFrameStats frame_;
+
+    void Rasterize(int slot, HFONT font, COLORREF color, const wchar_t* text, int length);
+
+public:
+    TextCache();
+    ~TextCache();
+
+    TextCache(const TextCache&) = delete;
+    TextCache& operator=(const TextCache&) = delete;
+
+    // 配置點陣圖（capacity 個格子）；失敗時 Draw 一律改用 TextOut
+    bool Initialize(int capacity = DEFAULT_CAPACITY);
+    void Release();
+
+    // 以目標 DC 目前的字型、文字顏色與對齊方式繪製，參數與 TextOut 相同
+    void Draw(HDC hdc, int x, int y, const wchar_t* text, int length);
+
+    // 統計資訊
+    void ResetFrameStats() { frame_ = TextCacheFrameStats(); }
+    const TextCacheFrameStats& GetFrameStats() const { return frame_; }
+    const TextCacheIndex& GetIndex() const { return index_; }
+};
@@ -0,0 +1,129 @@
+#include "TextCacheIndex.h"
+#include <algorithm>
+#include <cstring>
+
+TextCacheIndex::TextCacheIndex(int capacity)
+    : bucketMask_(0)
+    , size_(0)
+    , newest_(-1)
+    , oldest_(-1)
+    , hits_(0)
+    , misses_(0)
+    , evictions_(0)
+    , uncached_(0)
+{
+    Reset(capacity);
+}
+
+void TextCacheIndex::Reset(int capacity) {
+    entries_.assign(capacity > 0 ? capacity : 0, Entry());
+
+    // 雜湊桶數取容量兩倍以上的 2 的次方，鏈平均長度不到 1
+    uint32_t bucketCount = 1;
+    while ((int)bucketCount < capacity * 2) bucketCount <<= 1;
+    buckets_.assign(bucketCount, -1);
+    bucketMask_ = bucketCount - 1;
+    Clear();
+}
+
+void TextCacheIndex::Clear() {
+    std::fill(buckets_.begin(), buckets_.end(), -1);
+    size_ = 0;
+    newest_ = -1;
+    oldest_ = -1;
+}
+
+uint64_t TextCacheIndex::Hash(uint64_t font, uint32_t color, const wchar_t* text, int length) {
+    // FNV-1a
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    auto mix = [&hash](uint64_t value) {
+        hash ^= value;
+        hash *= 0x100000001B3ULL;
+    };
+    mix(font);
+    mix(color);
+    for (int i = 0; i < length; i++) mix((uint64_t)text[i]);
+    return hash;
+}
+
+void TextCacheIndex::Unlink(int slot) {
+    Entry& entry = entries_[slot];
+    if (entry.prev >= 0) entries_[entry.prev].next = entry.next;
+    else newest_ = entry.next;
+    if (entry.next >= 0) entries_[entry.next].prev = entry.prev;
+    else oldest_ = entry.prev;
+}
+
+void TextCacheIndex::PushNewest(int slot) {
+    Entry& entry = entries_[slot];
+    entry.prev = -1;
+    entry.next = newest_;
+    if (newest_ >= 0) entries_[newest_].prev = slot;
+    newest_ = slot;
+    if (oldest_ < 0) oldest_ = slot;
+}
+
+void TextCacheIndex::RemoveFromBucket(int slot) {
+    int* link = &buckets_[entries_[slot].hash & bucketMask_];
+    while (*link != slot) link = &entries_[*link].chain;
+    *link = entries_[slot].chain;
+}
+
+int TextCacheIndex::Lookup(uint64_t font, uint32_t color, const wchar_t* text, int length, bool& inserted) {
+    inserted = false;
+    if (entries_.empty() || length < 0 || length > MAX_TEXT_LENGTH) {
+        uncached_++;
+        return -1;
+    }
+
+    uint64_t hash = Hash(font, color, text, length);
+    int& bucket = buckets_[hash & bucketMask_];
+    for (int slot = bucket; slot >= 0; slot = entries_[slot].chain) {
+        const Entry& entry = entries_[slot];
+        if (entry.hash == hash && entry.font == font && entry.color == color && entry.length == length &&
+            std::memcmp(entry.text, text, length * sizeof(wchar_t)) == 0) {
+            hits_++;
+            if (slot != newest_) {
+                Unlink(slot);
+                PushNewest(slot);
+            }
+            return slot;
+        }
+    }
+
+    // 未命中：取空槽位，已滿則淘汰最舊的槽位（淘汰的槽位可能與新字串落在同一個桶）
+    misses_++;
+    int slot;
+    if (size_ < (int)entries_.size()) {
+        slot = size_++;
+    } else {
+        slot = oldest_;
+        Unlink(slot);
+        RemoveFromBucket(slot);
+        evictions_++;
+    }
+
+    Entry& entry = entries_[slot];
+    entry.hash = hash;
+    entry.font = font;
+    entry.color = color;
+    entry.length = length;
+    std::memcpy(entry.text, text, length * sizeof(wchar_t));
+    entry.chain = bucket;
+    bucket = slot;
+    PushNewest(slot);
+    inserted = true;
+    return slot;
+}
+
+double TextCacheIndex::GetHitRate() const {
+    uint64_t lookups = hits_ + misses_;
+    return lookups > 0 ? (double)hits_ / lookups : 0.0;
+}
+
+void TextCacheIndex::ResetStats() {
+    hits_ = 0;
+    misses_ = 0;
+    evictions_ = 0;
+    uncached_ = 0;
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// ============================================================================
+// 文字快取索引（LRU）
+// 以（字型, 顏色, 文字）查出固定容量槽位表中的槽位；找不到時取用空槽位，
+// 已滿則淘汰最久沒用到的槽位。槽位內容（預先繪製的點陣圖）由呼叫端依槽位編號管理
+// 雜湊鏈與 LRU 串列都以槽位編號串接，Reset 之後查詢不再配置記憶體
+// ============================================================================
+class TextCacheIndex {
+public:
+    static constexpr int MAX_TEXT_LENGTH = 96;      // 超過此長度的字串不進快取
+
+private:
+    struct Entry {
+        uint64_t hash;
+        uint64_t font;                   // 字型識別碼（Win32 前端為 HFONT）
+        uint32_t color;
+        int length;
+        int chain;                       // 同一個雜湊桶的下一個槽位
+        int prev;                        // LRU 串列（較新）
+        int next;                        // LRU 串列（較舊）
+        wchar_t text[MAX_TEXT_LENGTH];
+    };
+
+    std::vector<Entry> entries_;
+    std::vector<int> buckets_;           // 每個雜湊桶的第一個槽位（-1 表示空）
+    uint32_t bucketMask_;
+    int size_;                           // 已使用的槽位數
+    int newest_;                         // LRU 串列頭（最近使用）
+    int oldest_;                         // LRU 串列尾（下一個淘汰）
+    uint64_t hits_;
+    uint64_t misses_;
+    uint64_t evictions_;
+    uint64_t uncached_;                  // 過長而未進快取的查詢
+
+    static uint64_t Hash(uint64_t font, uint32_t color, const wchar_t* text, int length);
+    void Unlink(int slot);
+    void PushNewest(int slot);
+    void RemoveFromBucket(int slot);
+
+public:
+    explicit TextCacheIndex(int capacity = 0);
+
+    // 重新配置容量並清空（capacity 為 0 時所有查詢都不進快取）
+    void Reset(int capacity);
+    void Clear();
+
+    // 查詢並標記為最近使用，回傳槽位；inserted 為 true 表示是新槽位，呼叫端需重新繪製內容
+    // 字串過長或容量為 0 時回傳 -1
+    int Lookup(uint64_t font, uint32_t color, const wchar_t* text, int length, bool& inserted);
+
+    // 統計資訊
+    int GetCapacity() const { return (int)entries_.size(); }
+    int GetSize() const { return size_; }
+    uint64_t GetHits() const { return hits_; }
+    uint64_t GetMisses() const { return misses_; }
+    uint64_t GetEvictions() const { return evictions_; }
+    uint64_t GetUncached() const { return uncached_; }
+    double GetHitRate() const;
+    void ResetStats();
+};
@@ -0,0 +1,101 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <cwchar>
+#include <type_traits>
+
+// ============================================================================
+// 格式化文字標籤
+// 記住上次格式化時格式字串與所有參數的雜湊，參數沒變就沿用上次的字串，不重新呼叫 swprintf
+// 字串參數以內容計算雜湊（同一個指標指向的內容可能已經改變）
+// 格式字串沿用平台 swprintf 的寫法（Windows 上 %s 為寬字串、%hs 為窄字串）
+// ============================================================================
+class TextLabel {
+public:
+    static constexpr int MAX_LENGTH = 128;
+
+private:
+    uint64_t key_;
+    bool valid_;                         // 是否已格式化過
+    int length_;
+    int formatCount_;                    // 實際格式化的次數
+    wchar_t text_[MAX_LENGTH];
+
+    // FNV-1a
+    static void Mix(uint64_t& hash, uint64_t value) {
+        hash ^= value;
+        hash *= 0x100000001B3ULL;
+    }
+
+    static void MixValue(uint64_t& hash, const wchar_t* text) {
+        for (; text && *text; text++) Mix(hash, (uint64_t)*text);
+        Mix(hash, 0);
+    }
+
+    static void MixValue(uint64_t& hash, const char* text) {
+        for (; text && *text; text++) Mix(hash, (uint8_t)*text);
+        Mix(hash, 0);
+    }
+
+    template<typename T>
+    static void MixValue(uint64_t& hash, T value) {
+        static_assert(!std::is_pointer<T>::value, "字串參數需為 const wchar_t* 或 const char*");
+        if constexpr (std::is_floating_point<T>::value) {
+            double wide = value;
+            uint64_t bits;
+            std::memcpy(&bits, &wide, sizeof(bits));
+            Mix(hash, bits);
+        } else {
+            Mix(hash, (uint64_t)value);
+        }
+    }
+
+    bool UpdateKey(uint64_t key) {
+        if (valid_ && key == key_) return false;
+        key_ = key;
+        valid_ = true;
+        return true;
+    }
+
+public:
+    TextLabel() : key_(0), valid_(false), length_(0), formatCount_(0) { text_[0] = L'\0'; }
+
+    // 參數與上次相同時不做任何事並回傳 false；否則重新格式化並回傳 true
+    template<typename... Args>
+    bool Format(const wchar_t* format, Args... args) {
+        uint64_t key = 0xCBF29CE484222325ULL;
+        MixValue(key, format);
+        (MixValue(key, args), ...);
+        if (!UpdateKey(key)) return false;
+
+        int length = std::swprintf(text_, MAX_LENGTH, format, args...);
+        if (length < 0) {
+            // 超過長度：保留截斷後的內容
+            text_[MAX_LENGTH - 1] = L'\0';
+            length = (int)std::wcslen(text_);
+        }
+        length_ = length;
+        formatCount_++;
+        return true;
+    }
+
+    // 自行組字串時使用：數值與上次相同時回傳 false；否則回傳 true，
+    // 呼叫端寫入 GetBuffer() 後以 SetLength 設定長度
+    bool Changed(const int* values, int count) {
+        uint64_t key = 0xCBF29CE484222325ULL;
+        for (int i = 0; i < count; i++) Mix(key, (uint64_t)(uint32_t)values[i]);
+        if (!UpdateKey(key)) return false;
+        formatCount_++;
+        return true;
+    }
+    wchar_t* GetBuffer() { return text_; }
+    void SetLength(int length) { length_ = length; }
+
+    // 下次 Format 必定重新格式化
+    void Invalidate() { valid_ = false; }
+
+    // 存取方法
+    const wchar_t* GetText() const { return text_; }
+    int GetLength() const { return length_; }
+    int GetFormatCount() const { return formatCount_; }
+};
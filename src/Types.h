@@ -1,5 +1,5 @@
 #pragma once
-#include <windows.h>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <cmath>
@@ -17,6 +17,8 @@ namespace GameConstants {
     constexpr int MAP_WIDTH = 2000;
     constexpr int MAP_HEIGHT = 1500;
     constexpr int TILE_SIZE = 50;
+    constexpr int SIMULATION_HZ = 60;                         // 模擬更新頻率
+    constexpr float FIXED_TIMESTEP = 1.0f / SIMULATION_HZ;    // 模擬固定步長（秒）
     
     // 角色設定
     constexpr int HERO_SIZE = 40;
@@ -30,20 +32,45 @@ namespace GameConstants {
     constexpr int BASE_ATTACK = 10;
     constexpr int ATTACK_PER_LEVEL = 5;
     constexpr int ATTACK_RANGE = 60;
+    constexpr int MAX_MONSTER_LEVEL = 9;          // 怪獸最高等級
+    constexpr float SPAWN_SAFE_RADIUS = 200.0f;   // 英雄周圍不生成怪獸的半徑
+    constexpr int CHASE_TILES = 12;               // 怪獸開始追擊英雄的距離（格）
+    constexpr float MELEE_INTERVAL = 1.0f;        // 怪獸近戰攻擊間隔（秒）
     
     // 怪獸數量
-    constexpr int INITIAL_MONSTER_COUNT = 15;
+    constexpr int INITIAL_MONSTER_COUNT = 15;     // 怪獸池容量（每波補滿空槽）
+    constexpr int WAVE_COUNT = 5;                 // 每局波數，最後一波清空即勝利
+    constexpr float WAVE_INTERVAL = 20.0f;        // 波與波的間隔秒數（場上清空時提前）
+}
+
+// ============================================================================
+// 按鍵代碼（數值與 Win32 虛擬鍵碼相同，模擬核心不需引入 <windows.h>）
+// ============================================================================
+namespace KeyCodes {
+    constexpr int ENTER = 0x0D;
+    constexpr int SPACE = 0x20;
+    constexpr int LEFT = 0x25;
+    constexpr int UP = 0x26;
+    constexpr int RIGHT = 0x27;
+    constexpr int DOWN = 0x28;
 }
 
 // ============================================================================
 // 列舉型別
 // ============================================================================
 
-// 武器類型
+// 武器外形（數值由內容檔定義，外形只決定繪製方式）
 enum class WeaponType {
     None,
-    Sword,  // 劍：攻速快，傷害中等
-    Axe     // 斧頭：攻速慢，傷害高
+    Sword,  // 劍
+    Axe     // 斧頭
+};
+
+// 攻擊判定範圍（由內容檔定義，與外形無關）
+enum class HitShape {
+    Circle, // 以英雄為中心的圓
+    Arc,    // 朝面向方向展開的扇形
+    Line    // 從英雄朝面向方向延伸的直線（帶寬度）
 };
 
 // 遊戲狀態
@@ -67,6 +94,13 @@ enum class Direction {
 // 基礎結構
 // ============================================================================
 
+// 顏色（與 Win32 COLORREF 相同的 0x00BBGGRR 配置，可直接傳給 GDI）
+typedef uint32_t Color;
+
+constexpr Color MakeColor(int r, int g, int b) {
+    return (Color)((r & 0xFF) | ((g & 0xFF) << 8) | ((b & 0xFF) << 16));
+}
+
 // 2D 向量
 struct Vector2D {
     float x;
@@ -91,10 +125,19 @@ struct Vector2D {
         return std::sqrt(x * x + y * y);
     }
     
+    // 只需比較距離時使用，省去開根號
+    float LengthSquared() const {
+        return x * x + y * y;
+    }
+    
     float DistanceTo(const Vector2D& other) const {
         return (*this - other).Length();
     }
     
+    float DistanceSquaredTo(const Vector2D& other) const {
+        return (*this - other).LengthSquared();
+    }
+    
     Vector2D Normalize() const {
         float len = Length();
         if (len > 0) {
@@ -104,33 +147,22 @@ struct Vector2D {
     }
 };
 
-// 武器屬性
+// 武器屬性（由 ContentDatabase 載入）
 struct WeaponStats {
-    WeaponType type;
+    int index;            // 在內容資料中的編號（-1 表示未裝備）
+    WeaponType type;      // 外形
     std::wstring name;
+    std::wstring description;
     int damage;           // 傷害加成
     int attackSpeed;      // 攻擊間隔（毫秒）
-    COLORREF color;       // 武器顏色
+    Color color;          // 武器顏色
+    HitShape hitShape;    // 攻擊判定範圍
+    float range;          // 判定距離（像素，從英雄中心量到怪獸邊緣）
+    float arcDegrees;     // 扇形的張角（度）
+    float lineWidth;      // 直線的寬度（像素）
+    int maxTargets;       // 每次攻擊最多命中數（依距離由近到遠，0 表示不限）
     
-    WeaponStats() : type(WeaponType::None), damage(0), attackSpeed(0), color(RGB(128, 128, 128)) {}
-    
-    static WeaponStats GetSword() {
-        WeaponStats stats;
-        stats.type = WeaponType::Sword;
-        stats.name = L"長劍";
-        stats.damage = 15;
-        stats.attackSpeed = 500;  // 0.5秒攻擊一次
-        stats.color = RGB(192, 192, 192);  // 銀色
-        return stats;
-    }
-    
-    static WeaponStats GetAxe() {
-        WeaponStats stats;
-        stats.type = WeaponType::Axe;
-        stats.name = L"戰斧";
-        stats.damage = 30;
-        stats.attackSpeed = 1000;  // 1秒攻擊一次
-        stats.color = RGB(139, 69, 19);  // 棕色
-        return stats;
-    }
+    WeaponStats() : index(-1), type(WeaponType::None), damage(0), attackSpeed(0), color(MakeColor(128, 128, 128)),
+                    hitShape(HitShape::Circle), range((float)GameConstants::ATTACK_RANGE), arcDegrees(360.0f),
+                    lineWidth(0), maxTargets(1) {}
 };